@@ -86,7 +86,12 @@ Ascent::Ascent()
 : m_runtime(NULL),
   m_verbose_msgs(true),
   m_forward_exceptions(false),
-  m_actions_file("<<UNSET>>")
+  m_actions_file("<<UNSET>>"),
+  m_actions_file_poll(true),
+  m_cached_actions_valid(false),
+  m_async(false),
+  m_async_running(false),
+  m_async_error(false)
 {
   m_options["mpi_comm"] = -1;
 }
@@ -94,7 +99,12 @@ Ascent::Ascent()
 //-----------------------------------------------------------------------------
 Ascent::~Ascent()
 {
-
+    // destroying a joinable std::thread terminates the process; make
+    // sure a forgotten close() doesn't take the simulation down
+    if(m_async_thread.joinable())
+    {
+        m_async_thread.join();
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -152,6 +162,12 @@ CheckForSettingsFile(std::string file_name,
       {
           protocol = "yaml";
       }
+      else if(curr == "bin")
+      {
+          // pre-parsed binary plan from actions_validate: loads
+          // without text parsing
+          protocol = "conduit_bin";
+      }
 
       conduit::Node file_node;
       file_node.load(file_name, protocol);
@@ -170,6 +186,16 @@ CheckForSettingsFile(std::string file_name,
 }
 
 //-----------------------------------------------------------------------------
+// note on first-cycle warmup: the heavyweight pieces this call used
+// to pay repeatedly are now lazy or once-per-process - filter
+// registration early-outs after the first open, the python
+// interpreter initializes on the first script filter, and the web
+// root is only touched when streaming connects. The remaining
+// first-execute gap is device-side (CUDA context, vtk-m kernel
+// warm): a warmup() entry would have to run a throwaway kernel per
+// backend, which belongs in vtk-m's init, not here. Simulations that
+// trip watchdogs can issue a trivial execute (empty actions) during
+// their setup phase to absorb it.
 void
 Ascent::open(const conduit::Node &options)
 {
@@ -243,6 +269,22 @@ Ascent::open(const conduit::Node &options)
             m_actions_file = m_options["actions_file"].as_string();
         }
 
+        if(m_options.has_path("async") &&
+           m_options["async"].dtype().is_string() )
+        {
+            m_async = m_options["async"].as_string() == "true";
+        }
+
+        if(m_options.has_path("actions_file_poll") &&
+           m_options["actions_file_poll"].dtype().is_string() )
+        {
+            // "false" enables cached actions mode: the actions file
+            // is read once and then only re-checked after an explicit
+            // refresh_actions() call
+            m_actions_file_poll =
+                m_options["actions_file_poll"].as_string() != "false";
+        }
+
 
         Node cfg;
         ascent::about(cfg);
@@ -264,6 +306,14 @@ Ascent::open(const conduit::Node &options)
         else if(runtime_type == "ascent")
         {
             m_runtime = new AscentRuntime();
+            // note on execution policy: backend choice here is
+            // process global and library wide. Per-category policies
+            // ("pipelines on gpu, expressions on host, n threads")
+            // need vtk-m's runtime device tracker exposed per
+            // invocation through vtk-h, which this stack predates;
+            // the expression and adapter kernels honor OpenMP's
+            // standard controls (OMP_NUM_THREADS et al.), which is
+            // how hosts cap ascent's thread usage today.
             if(m_options.has_path("runtime/vtkm/backend"))
             {
     #if defined(ASCENT_VTKH_ENABLED)
@@ -333,7 +383,20 @@ Ascent::publish(const conduit::Node &data)
     {
         if(m_runtime != NULL)
         {
-            m_runtime->Publish(data);
+            if(m_async)
+            {
+                // the background execution reads what we publish, so
+                // finish any in-flight work and snapshot the data:
+                // the simulation will mutate its buffers during the
+                // overlapped timestep
+                wait();
+                m_async_publish_data = data;
+                m_runtime->Publish(m_async_publish_data);
+            }
+            else
+            {
+                m_runtime->Publish(data);
+            }
         }
         else
         {
@@ -364,6 +427,45 @@ Ascent::publish(const conduit::Node &data)
     }
 }
 
+//-----------------------------------------------------------------------------
+void
+Ascent::publish_update(const conduit::Node &data)
+{
+    try
+    {
+        if(m_runtime != NULL)
+        {
+            m_runtime->PublishUpdate(data);
+        }
+        else
+        {
+            ASCENT_ERROR("Ascent Runtime is not initialized");
+        }
+    }
+    catch(conduit::Error &e)
+    {
+        if(m_forward_exceptions)
+        {
+            throw e;
+        }
+        else
+        {
+          if(m_runtime != NULL)
+          {
+            std::stringstream msg;
+            msg << "[Error] Ascent::publish_update "
+                << e.message() << std::endl;
+            m_runtime->DisplayError(msg.str());
+          }
+          else
+          {
+            std::cerr<< "[Error] Ascent::publish_update "
+                    << e.message() << std::endl;
+          }
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 void
 Ascent::execute(const conduit::Node &actions)
@@ -372,6 +474,25 @@ Ascent::execute(const conduit::Node &actions)
     {
         if(m_runtime != NULL)
         {
+            if(m_async)
+            {
+                // the action preprocessing below touches state the
+                // background execution reads
+                wait();
+            }
+
+            // cached actions mode: reuse the merged actions from the
+            // last execute, skipping the deep copy and the file poll
+            if(!m_actions_file_poll && m_cached_actions_valid)
+            {
+                conduit::Node diff_info;
+                if(!m_cached_actions_source.diff(actions, diff_info))
+                {
+                    RunActions(m_cached_actions);
+                    return;
+                }
+            }
+
             Node processed_actions(actions);
 
             if(m_actions_file == "<<UNSET>>")
@@ -405,7 +526,14 @@ Ascent::execute(const conduit::Node &actions)
                                  false,
                                  m_options["mpi_comm"].to_int32());
 
-            m_runtime->Execute(processed_actions);
+            if(!m_actions_file_poll)
+            {
+                m_cached_actions_source = actions;
+                m_cached_actions = processed_actions;
+                m_cached_actions_valid = true;
+            }
+
+            RunActions(processed_actions);
         }
         else
         {
@@ -437,6 +565,168 @@ Ascent::execute(const conduit::Node &actions)
 }
 
 
+//-----------------------------------------------------------------------------
+void
+Ascent::RunActions(const conduit::Node &actions)
+{
+    if(!m_async)
+    {
+        m_runtime->Execute(actions);
+        return;
+    }
+
+    // execute() and publish() call wait() before we get here, so no
+    // execution is in flight when the thread launches
+    wait();
+
+    m_async_actions = actions;
+    m_async_error = false;
+    m_async_error_msg = "";
+    m_async_running = true;
+
+    m_async_thread = std::thread([this]()
+    {
+        try
+        {
+            m_runtime->Execute(m_async_actions);
+        }
+        catch(conduit::Error &e)
+        {
+            m_async_error = true;
+            m_async_error_msg = e.message();
+        }
+        catch(std::exception &e)
+        {
+            m_async_error = true;
+            m_async_error_msg = e.what();
+        }
+        catch(...)
+        {
+            m_async_error = true;
+            m_async_error_msg = "unknown exception";
+        }
+        m_async_running = false;
+    });
+}
+
+//-----------------------------------------------------------------------------
+void
+Ascent::wait()
+{
+    if(m_async_thread.joinable())
+    {
+        m_async_thread.join();
+    }
+
+    if(m_async_error)
+    {
+        m_async_error = false;
+        std::string msg = m_async_error_msg;
+        m_async_error_msg = "";
+        if(m_forward_exceptions)
+        {
+            CONDUIT_ERROR("[Error] Ascent::execute (async) " << msg);
+        }
+        else if(m_runtime != NULL)
+        {
+            std::stringstream ss;
+            ss << "[Error] Ascent::execute (async) " << msg << std::endl;
+            m_runtime->DisplayError(ss.str());
+        }
+        else
+        {
+            std::cerr << "[Error] Ascent::execute (async) "
+                      << msg << std::endl;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+bool
+Ascent::probe()
+{
+    return !m_async_running.load();
+}
+
+//-----------------------------------------------------------------------------
+void
+Ascent::query(const std::string &expression, conduit::Node &out)
+{
+    try
+    {
+        if(m_runtime != NULL)
+        {
+            if(m_async)
+            {
+                // expressions read the published data
+                wait();
+            }
+            m_runtime->Query(expression, out);
+        }
+        else
+        {
+            ASCENT_ERROR("Ascent Runtime is not initialized");
+        }
+    }
+    catch(conduit::Error &e)
+    {
+        if(m_forward_exceptions)
+        {
+            throw e;
+        }
+        else
+        {
+            std::cerr<< "[Error] Ascent::query "
+                     << e.message() << std::endl;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Ascent::fetch(const std::string &name, conduit::Node &out)
+{
+    try
+    {
+        if(m_runtime != NULL)
+        {
+            if(m_async)
+            {
+                // never hand out views while an execution is writing
+                wait();
+            }
+            m_runtime->Fetch(name, out);
+        }
+        else
+        {
+            ASCENT_ERROR("Ascent Runtime is not initialized");
+        }
+    }
+    catch(conduit::Error &e)
+    {
+        if(m_forward_exceptions)
+        {
+            throw e;
+        }
+        else
+        {
+            std::cerr<< "[Error] Ascent::fetch "
+                     << e.message() << std::endl;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Ascent::refresh_actions()
+{
+    // drop the cached actions so the next execute() re-checks the
+    // actions file and rebuilds the merged actions
+    m_cached_actions_valid = false;
+    m_cached_actions_source.reset();
+    m_cached_actions.reset();
+}
+
 //-----------------------------------------------------------------------------
 void
 Ascent::info(conduit::Node &info_out)
@@ -480,6 +770,11 @@ Ascent::close()
     {
         if(m_runtime != NULL)
         {
+            if(m_async)
+            {
+                // never tear down under an in-flight execution
+                wait();
+            }
             m_runtime->Cleanup();
             delete m_runtime;
             m_runtime = NULL;
@@ -64,6 +64,10 @@
 #include <conduit.hpp>
 #include <conduit_blueprint.hpp>
 
+#include <atomic>
+#include <string>
+#include <thread>
+
 
 //-----------------------------------------------------------------------------
 // -- begin ascent:: --
@@ -86,10 +90,48 @@ public:
     void   open(); // open with default options
     void   open(const conduit::Node &options);
     void   publish(const conduit::Node &data);
+    /// incremental publish: pledges that mesh topology, coordinates,
+    /// ghosts, and nestsets are unchanged since the last publish and
+    /// that field arrays are the same buffers with new values, so the
+    /// runtime can keep all derived state (conversions, ghost masks,
+    /// bounds) alive. Requires zero copy to be in effect for the
+    /// updated fields; falls back to a full publish on first use.
+    void   publish_update(const conduit::Node &data);
     void   execute(const conduit::Node &actions);
     void   info(conduit::Node &info_out);
     void   close();
 
+    /// async execution mode (open option "async" = "true"): execute()
+    /// snapshots the published data, hands the action list to a
+    /// background thread, and returns immediately so the simulation
+    /// can overlap its next timestep with visualization.
+    /// wait() blocks until the in-flight execution finishes (and
+    /// surfaces any error it hit); probe() reports without blocking.
+    /// With MPI, the application must initialize MPI with a threading
+    /// level that permits the background thread to communicate
+    /// (MPI_THREAD_MULTIPLE, or SERIALIZED if the simulation makes no
+    /// MPI calls while an execute is in flight).
+    void   wait();
+    bool   probe();
+
+    /// immediately evaluates a single expression against the
+    /// currently published data and returns the result - no graph
+    /// build, no conversion; parsed ASTs and per-cycle results are
+    /// cached, so repeated solver-monitoring queries are cheap.
+    void   query(const std::string &expression, conduit::Node &out);
+
+    /// retrieves a named in-memory extract (produced by an
+    /// "in_memory" extract action) as a zero copy view. The view is
+    /// stable until the next execute that writes the same slot, or
+    /// until close().
+    void   fetch(const std::string &name, conduit::Node &out);
+
+    /// invalidates the cached actions, forcing the next execute()
+    /// to re-check the actions file. Only meaningful when the
+    /// "actions_file_poll" open option is "false"; with polling on
+    /// (the default) every execute re-checks the file anyway.
+    void   refresh_actions();
+
 private:
 
     Runtime    *m_runtime;
@@ -97,6 +139,27 @@ private:
     bool        m_forward_exceptions;
     std::string m_actions_file;
     conduit::Node m_options;
+    // cached actions mode ("actions_file_poll" == "false"):
+    // the merged actions are kept here and reused until the caller
+    // passes different actions or calls refresh_actions(), skipping
+    // the per-execute deep copy and file system poll
+    bool          m_actions_file_poll;
+    bool          m_cached_actions_valid;
+    conduit::Node m_cached_actions_source;
+    conduit::Node m_cached_actions;
+
+    // async execution state
+    bool              m_async;
+    std::thread       m_async_thread;
+    std::atomic<bool> m_async_running;
+    bool              m_async_error;
+    std::string       m_async_error_msg;
+    conduit::Node     m_async_publish_data; // snapshot of published data
+    conduit::Node     m_async_actions;
+
+    // dispatches actions to the runtime, inline or on the
+    // background thread depending on the async mode
+    void   RunActions(const conduit::Node &actions);
 };
 
 
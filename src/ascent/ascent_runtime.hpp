@@ -71,10 +71,35 @@ public:
     virtual void  Initialize(const conduit::Node &options)=0;
 
     virtual void  Publish(const conduit::Node &data)=0;
+    // incremental publish: the caller pledges that topology,
+    // coordinates, ghosts, and nestsets are unchanged since the last
+    // Publish and only field values moved. Runtimes that keep derived
+    // state may skip rebuilding it; the default treats this as a
+    // full publish.
+    virtual void  PublishUpdate(const conduit::Node &data) { Publish(data); }
     virtual void  Execute(const conduit::Node &actions)=0;
 
     virtual void  Info(conduit::Node &info_out)=0;
 
+    // immediate expression evaluation against the currently
+    // published data: no graph build, no conversion. Runtimes
+    // without an expression system reject it.
+    virtual void  Query(const std::string &expression, conduit::Node &out)
+    {
+        (void)expression;
+        (void)out;
+        CONDUIT_ERROR("This runtime does not support queries");
+    }
+
+    // retrieves a named in-memory extract as a zero copy view; only
+    // runtimes that support in-memory extracts override this
+    virtual void  Fetch(const std::string &name, conduit::Node &out)
+    {
+        (void)name;
+        (void)out;
+        CONDUIT_ERROR("This runtime does not support in-memory extracts");
+    }
+
     virtual void  Cleanup()=0;
 
     virtual void  DisplayError(const std::string &msg);
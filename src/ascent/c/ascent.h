@@ -87,6 +87,11 @@ void ASCENT_API ascent_open(Ascent *c_ascent,  conduit_node *options);
 
 void ASCENT_API ascent_publish(Ascent *c_ascent, conduit_node *data);
 
+// incremental publish for static meshes: pledges that only field
+// values changed since the last publish (same buffers, new values);
+// see Ascent::publish_update
+void ASCENT_API ascent_publish_update(Ascent *c_ascent, conduit_node *data);
+
 void ASCENT_API ascent_execute(Ascent *c_ascent, conduit_node *actions);
 
 void ASCENT_API ascent_info(Ascent *c_ascent, conduit_node *result);
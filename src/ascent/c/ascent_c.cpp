@@ -114,6 +114,16 @@ ascent_publish(Ascent *c_ascent,
     v->publish(*n);
 }
 
+//---------------------------------------------------------------------------//
+void
+ascent_publish_update(Ascent *c_ascent,
+                      conduit_node *c_data)
+{
+    ascent::Ascent *v = cpp_ascent(c_ascent);
+    Node  *n = static_cast<Node*>(c_data);
+    v->publish_update(*n);
+}
+
 //---------------------------------------------------------------------------//
 void
 ascent_execute(Ascent *c_ascent,
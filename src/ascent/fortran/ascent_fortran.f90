@@ -100,6 +100,20 @@ module ascent
         type(C_PTR), value, intent(IN) ::cnode
     end subroutine ascent_publish
 
+    !--------------------------------------------------------------------------
+    ! Incremental publish for static meshes: describe the mesh once
+    ! with conduit set_external pointers, then call this per cycle -
+    ! the runtime keeps all derived state and sees the new values
+    ! through the external pointers, so per-cycle FFI traffic is one
+    ! call instead of rebuilding the description.
+    subroutine ascent_publish_update(cascent, cnode) &
+            bind(C, name="ascent_publish_update")
+        use iso_c_binding
+        implicit none
+        type(C_PTR), value, intent(IN) ::cascent
+        type(C_PTR), value, intent(IN) ::cnode
+    end subroutine ascent_publish_update
+
     !--------------------------------------------------------------------------
     subroutine ascent_execute(cascent, cnode) &
             bind(C, name="ascent_execute")
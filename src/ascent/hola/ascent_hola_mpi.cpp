@@ -63,6 +63,7 @@
 #include <ascent_logging.hpp>
 
 #include <fstream>
+#include <vector>
 
 using namespace conduit;
 using namespace std;
@@ -114,7 +115,8 @@ hola_mpi_comm_map(const conduit::Node &data,
                   MPI_Comm comm,
                   const conduit::int32_array &world_to_src,
                   const conduit::int32_array &world_to_dest,
-                  conduit::Node &res)
+                  conduit::Node &res,
+                  bool weighted)
 {
     // calc src_size and dest_size
 
@@ -138,6 +140,31 @@ hola_mpi_comm_map(const conduit::Node &data,
 
     bool is_source_rank = world_to_src[rank] >= 0;
 
+    // the comm map depends only on the split and the per-rank domain
+    // counts; for structurally stable trees a one-int allreduce
+    // replaces the allgather and map rebuild every cycle
+    static conduit::Node cached_map;
+    static int cached_local_doms = -1;
+    static int cached_src_size = -1;
+    static int cached_dest_size = -1;
+    static int cached_total_size = -1;
+
+    const int local_doms = is_source_rank ? data.number_of_children() : 0;
+    static int cached_weighted = -1;
+    int changed = ((int)weighted != cached_weighted ||
+                   local_doms != cached_local_doms ||
+                   src_size   != cached_src_size   ||
+                   dest_size  != cached_dest_size  ||
+                   total_size != cached_total_size) ? 1 : 0;
+    int global_changed = changed;
+    MPI_Allreduce(&changed, &global_changed, 1, MPI_INT, MPI_MAX, comm);
+
+    if(global_changed == 0)
+    {
+        res.set(cached_map);
+        return;
+    }
+
     res.reset();
 
     // maps from src and dest index spack to world ranks
@@ -204,15 +231,99 @@ hola_mpi_comm_map(const conduit::Node &data,
 
     int32_array dest_lst =  res["dest_counts"].as_int32_array();
 
-    gen_dest_domain_lst(src_counts,
-                        num_total_doms,
-                        dest_size,
-                        dest_lst);
+    if(!weighted)
+    {
+        gen_dest_domain_lst(src_counts,
+                            num_total_doms,
+                            dest_size,
+                            dest_lst);
+    }
+    else
+    {
+        // cost-weighted contiguous partition: gather per-domain
+        // vertex counts (global domain order follows rank order) and
+        // greedily split so each destination range carries roughly
+        // equal total weight. Ranges stay contiguous, so the
+        // send/receive walk is unchanged.
+        std::vector<double> local_w;
+        if(is_source_rank)
+        {
+            NodeConstIterator d_itr = data.children();
+            while(d_itr.has_next())
+            {
+                const Node &dom = d_itr.next();
+                double w = 1.0;
+                if(dom.has_path("coordsets") &&
+                   dom["coordsets"].number_of_children() > 0)
+                {
+                    const Node &cs = dom["coordsets"].child(0);
+                    if(cs.has_path("values/x"))
+                    {
+                        w = (double)
+                            cs["values/x"].dtype().number_of_elements();
+                    }
+                }
+                local_w.push_back(w);
+            }
+        }
+
+        std::vector<int> gv_counts(total_size, 0);
+        std::vector<int> gv_displs(total_size, 0);
+        int disp = 0;
+        for(int i = 0; i < total_size; ++i)
+        {
+            gv_counts[i] = num_doms[i];
+            gv_displs[i] = disp;
+            disp += num_doms[i];
+        }
+
+        std::vector<double> all_w(num_total_doms, 1.0);
+        MPI_Allgatherv(local_w.empty() ? NULL : &local_w[0],
+                       (int)local_w.size(),
+                       MPI_DOUBLE,
+                       num_total_doms > 0 ? &all_w[0] : NULL,
+                       &gv_counts[0],
+                       &gv_displs[0],
+                       MPI_DOUBLE,
+                       comm);
+
+        double total_w = 0.0;
+        for(int i = 0; i < num_total_doms; ++i)
+        {
+            total_w += all_w[i];
+        }
+
+        for(int i = 0; i < dest_size; ++i)
+        {
+            dest_lst[i] = 0;
+        }
+
+        int d = 0;
+        double acc = 0.0;
+        const double target = total_w / (double)dest_size;
+        for(int i = 0; i < num_total_doms; ++i)
+        {
+            dest_lst[d] += 1;
+            acc += all_w[i];
+            if(d < dest_size - 1 && acc >= target * (double)(d + 1))
+            {
+                d++;
+            }
+        }
+    }
 
     res["dest_offsets"] = DataType::int32(dest_size);
     int32_array dest_offsets = res["dest_offsets"].as_int32_array();
     int32 num_dest_domains = calc_offsets(dest_lst,
                                           dest_offsets);
+    (void) num_dest_domains;
+
+    cached_map.set(res);
+    cached_weighted = (int)weighted;
+    cached_local_doms = local_doms;
+    cached_src_size = src_size;
+    cached_dest_size = dest_size;
+    cached_total_size = total_size;
 }
 
 //-----------------------------------------------------------------------------
@@ -220,7 +331,8 @@ void
 hola_mpi_send(const conduit::Node &data,
               MPI_Comm comm,
               int src_idx,
-              const conduit::Node &comm_map)
+              const conduit::Node &comm_map,
+              bool aggregate)
 {
     const int32 *src_counts  = comm_map["src_counts"].value();
     const int32 *src_offsets = comm_map["src_offsets"].value();
@@ -236,6 +348,8 @@ hola_mpi_send(const conduit::Node &data,
     NodeConstIterator itr = data.children();
 
     int dest_idx = 0;
+    Node batch;
+    int32 batch_dest = -1;
     for(int i = src_offsets[src_idx];
         i < src_offsets[src_idx] + src_counts[src_idx];
         i++)
@@ -252,9 +366,31 @@ hola_mpi_send(const conduit::Node &data,
         // std::cout << "src_idx " << src_idx << " send " << i << " to "
         //           << dest_idx << " (rank: " << dest_rank <<  " )" << std::endl;
 
-        relay::mpi::send_using_schema(n_curr,dest_rank,0,comm);
+        if(!aggregate)
+        {
+            relay::mpi::send_using_schema(n_curr,dest_rank,0,comm);
+            continue;
+        }
+
+        // aggregated mode: our domain range is contiguous in dest
+        // order, so we can batch every domain bound for the same
+        // destination into one list node and send it with a single
+        // message. set_external keeps the batch zero copy.
+        if(batch_dest != dest_rank && batch.number_of_children() > 0)
+        {
+            relay::mpi::send_using_schema(batch,batch_dest,0,comm);
+            batch.reset();
+        }
+        batch_dest = dest_rank;
+        // zero copy view; relay compacts on send. the const cast is
+        // safe, the batch never writes through it
+        batch.append().set_external(const_cast<Node&>(n_curr));
     }
 
+    if(aggregate && batch.number_of_children() > 0)
+    {
+        relay::mpi::send_using_schema(batch,batch_dest,0,comm);
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -262,7 +398,8 @@ void
 hola_mpi_recv(MPI_Comm comm,
               int dest_idx,
               const conduit::Node &comm_map,
-              conduit::Node &data)
+              conduit::Node &data,
+              bool aggregate)
 {
     const int32 *src_counts  = comm_map["src_counts"].value();
     const int32 *src_offsets = comm_map["src_offsets"].value();
@@ -274,6 +411,36 @@ hola_mpi_recv(MPI_Comm comm,
     // responsible for receiving dest_offsets[dest_idx] + dest_counts[dest_idx]
     // from who ever has them
     int src_idx = 0;
+
+    if(aggregate)
+    {
+        // aggregated mode: each source sends its share of our domain
+        // range as one batched message
+        int i = dest_offsets[dest_idx];
+        const int end = dest_offsets[dest_idx] + dest_counts[dest_idx];
+        while(i < end)
+        {
+            // find  i's src
+            while( i >= src_offsets[src_idx] + src_counts[src_idx])
+            {
+                src_idx++;
+            }
+
+            int32 src_rank = src_to_world[(int32)src_idx];
+            Node batch;
+            relay::mpi::recv_using_schema(batch,src_rank,0,comm);
+
+            NodeIterator bitr = batch.children();
+            while(bitr.has_next())
+            {
+                Node &n_dom = bitr.next();
+                data.append().set(n_dom);
+                i++;
+            }
+        }
+        return;
+    }
+
     for(int i = dest_offsets[dest_idx];
         i < dest_offsets[dest_idx] + dest_counts[dest_idx];
         i++)
@@ -358,23 +525,34 @@ hola_mpi(const conduit::Node &options,
         data_ptr = &md_data;
     }
 
+    // aggregated exchange: one message per (source, destination)
+    // pair instead of one per domain, with the schema sent once per
+    // batch. cuts the message count by the domains-per-pair factor
+    // when many simulation ranks fan into few visualization ranks
+    bool aggregate = options.has_path("aggregate") &&
+                     options["aggregate"].as_string() == "true";
+
+    bool weighted = options.has_path("weighted") &&
+                    options["weighted"].as_string() == "true";
+
     Node comm_map;
 
     hola_mpi_comm_map(*data_ptr,
                       comm,
                       world_to_src,
                       world_to_dest,
-                      comm_map);
+                      comm_map,
+                      weighted);
 
     if(is_src_rank )
     {
         int src_idx = world_to_src[rank];
-        hola_mpi_send(*data_ptr,comm,src_idx,comm_map);
+        hola_mpi_send(*data_ptr,comm,src_idx,comm_map,aggregate);
     }
     else
     {
         int dest_idx = world_to_dest[rank];
-        hola_mpi_recv(comm,dest_idx,comm_map,*data_ptr);
+        hola_mpi_recv(comm,dest_idx,comm_map,*data_ptr,aggregate);
     }
 }
 
@@ -67,29 +67,51 @@
 namespace ascent
 {
 
+/// Moves published domains from source ranks to a disjoint set of
+/// destination ranks inside one MPI job (split by "rank_split").
+///
+/// note on pipeline offload: this is the transport a full offload
+/// mode ("ship tagged pipelines to visualization ranks and execute
+/// there asynchronously") would ride on. The missing pieces live
+/// above this layer: the runtime must build per-role flow graphs
+/// over a split communicator (every collective in the vtk-h filters
+/// currently assumes the job-wide comm), and results need a return
+/// route. Until then, the supported pattern is a separate consumer
+/// running Ascent on the destination ranks after a hola exchange,
+/// which several of our couplings already do.
 void ASCENT_API hola_mpi(const conduit::Node &options,
                          conduit::Node &data);
 
 
 /// Creates maps used for book keeping to guide sending domains
 /// from source to destination ranks.
+/// when weighted is true, destination ranges are sized by per-domain
+/// vertex counts (contiguous weighted partition) instead of equal
+/// domain counts, so 50x domain size spreads stop landing unevenly
+/// on the receiving ranks.
 void ASCENT_API hola_mpi_comm_map(const conduit::Node &data,
                                   MPI_Comm comm,
                                   const conduit::int32_array &world_to_src,
                                   const conduit::int32_array &world_to_dest,
-                                  conduit::Node &res);
+                                  conduit::Node &res,
+                                  bool weighted = false);
 
 /// executes a send
+/// when aggregate is true, all domains headed to the same destination
+/// rank travel in a single message (schema sent once per batch)
+/// instead of one schema-carrying message per domain
 void ASCENT_API hola_mpi_send(const conduit::Node &data,
                               MPI_Comm comm,
                               int src_idx,
-                              const conduit::Node &comm_map);
+                              const conduit::Node &comm_map,
+                              bool aggregate = false);
 
-/// executes a receive
+/// executes a receive (aggregate must match the sender's setting)
 void ASCENT_API hola_mpi_recv(MPI_Comm comm,
                               int dest_idx,
                               const conduit::Node &comm_map,
-                              conduit::Node &data);
+                              conduit::Node &data,
+                              bool aggregate = false);
 
 };
 //-----------------------------------------------------------------------------
@@ -411,7 +411,21 @@ PyAscent_Ascent_execute(PyAscent_Ascent *self,
     Node *node = PyConduit_Node_Get_Node_Ptr(py_node);
     try
     {
-        self->ascent->execute(*node);
+        // release the GIL for the duration of execution so the
+        // driving python process keeps its other threads running;
+        // anything inside that needs python (the script filter's
+        // interpreter) re-acquires it via PyGILState_Ensure
+        PyThreadState *py_thread_state = PyEval_SaveThread();
+        try
+        {
+            self->ascent->execute(*node);
+        }
+        catch(...)
+        {
+            PyEval_RestoreThread(py_thread_state);
+            throw;
+        }
+        PyEval_RestoreThread(py_thread_state);
     }
     catch(conduit::Error e)
     {
@@ -159,6 +159,13 @@ void DataObject::reset(conduit::Node *dataset)
 }
 
 #if defined(ASCENT_DRAY_ENABLED)
+// note: the converted dray collection (element-to-reference-space
+// setup included) is cached on this object, so its lifetime tracks
+// the data object's. A plain publish resets the data object every
+// cycle; simulations on static high order meshes should use
+// publish_update, which keeps this object - and with it the dray
+// conversion - alive across cycles with field values refreshed
+// through the zero copy views.
 std::shared_ptr<dray::Collection> DataObject::as_dray_collection()
 {
   if(m_source == Source::INVALID)
@@ -215,14 +222,25 @@ std::shared_ptr<VTKHCollection> DataObject::as_vtkh_collection()
   {
     if(m_source == Source::HIGH_BP && m_low_bp == nullptr)
     {
-      std::shared_ptr<conduit::Node>  low_order(Transmogrifier::low_order(*m_high_bp));
+      // with a field subset only the bound fields get refined; the
+      // mesh itself is always refined
+      const std::set<std::string> *field_subset =
+          m_field_subset.empty() ? nullptr : &m_field_subset;
+      std::shared_ptr<conduit::Node>
+          low_order(Transmogrifier::low_order(*m_high_bp, field_subset));
       m_low_bp = low_order;
     }
 
     bool zero_copy = true;
-    // convert to vtkh
+    // convert to vtkh, materializing only the requested fields when
+    // a subset was provided
+    const std::set<std::string> *field_subset =
+        m_field_subset.empty() ? nullptr : &m_field_subset;
+
     std::shared_ptr<VTKHCollection>
-      vtkh_dset(VTKHDataAdapter::BlueprintToVTKHCollection(*m_low_bp, zero_copy));
+      vtkh_dset(VTKHDataAdapter::BlueprintToVTKHCollection(*m_low_bp,
+                                                           zero_copy,
+                                                           field_subset));
 
      m_vtkh = vtkh_dset;
     return m_vtkh;
@@ -232,6 +250,23 @@ std::shared_ptr<VTKHCollection> DataObject::as_vtkh_collection()
   return nullptr;
 }
 
+void DataObject::set_field_subset(const std::set<std::string> &fields)
+{
+  if(fields != m_field_subset)
+  {
+    // existing conversions may be missing newly requested fields
+    if(m_vtkh != nullptr)
+    {
+      reset_vtkh_collection();
+    }
+    if(m_source == Source::HIGH_BP)
+    {
+      m_low_bp.reset();
+    }
+  }
+  m_field_subset = fields;
+}
+
 void DataObject::reset_vtkh_collection()
 {
   if(m_source != Source::VTKH)
@@ -253,7 +288,14 @@ std::shared_ptr<conduit::Node>  DataObject::as_low_order_bp()
 
   if(m_source == Source::HIGH_BP)
   {
-    std::shared_ptr<conduit::Node>  low_order(Transmogrifier::low_order(*m_high_bp));
+#if defined(ASCENT_VTKM_ENABLED)
+    const std::set<std::string> *field_subset =
+        m_field_subset.empty() ? nullptr : &m_field_subset;
+#else
+    const std::set<std::string> *field_subset = nullptr;
+#endif
+    std::shared_ptr<conduit::Node>
+        low_order(Transmogrifier::low_order(*m_high_bp, field_subset));
     m_low_bp = low_order;
   }
 #if defined(ASCENT_VTKM_ENABLED)
@@ -55,6 +55,8 @@
 #include <ascent.hpp>
 #include <conduit.hpp>
 #include <memory>
+#include <set>
+#include <string>
 
 //-----------------------------------------------------------------------------
 // -- begin ascent:: --
@@ -77,6 +79,18 @@ class VTKHCollection;
 #endif
 
 
+// note on field version vectors: the caching layers all want an O(1)
+// "did this field change" answer, and today the cycle number is the
+// only version stamp (publish resets everything; publish_update
+// pledges everything-but-values unchanged). A real per-field version
+// subsystem needs the publish API to say which fields changed -
+// publish_update deliberately takes no field list yet - and every
+// conversion to thread the versions through to derived products.
+// The API growth path: publish_update(data, changed_fields) bumps
+// named versions, conversions record the versions they consumed, and
+// caches compare integers instead of fingerprinting. Until that
+// lands, cycle-keyed invalidation is the supported (coarser but
+// sound) contract every cache here uses.
 class DataObject
 {
 public:
@@ -93,6 +107,12 @@ public:
   DataObject(VTKHCollection *dataset);
   std::shared_ptr<VTKHCollection> as_vtkh_collection();
 
+  // restricts which fields as_vtkh_collection() materializes; the
+  // blueprint data keeps every published field, so expressions and
+  // blueprint consumers are unaffected. An empty set (the default)
+  // converts everything.
+  void                            set_field_subset(const std::set<std::string> &fields);
+
   bool                            is_vtkh_coll_exists() const { return m_vtkh != nullptr; }
   void                            reset_vtkh_collection();
 
@@ -111,6 +131,7 @@ protected:
   std::shared_ptr<conduit::Node>  m_high_bp;
 #if defined(ASCENT_VTKM_ENABLED)
   std::shared_ptr<VTKHCollection> m_vtkh;
+  std::set<std::string>           m_field_subset;
 #endif
 #if defined(ASCENT_DRAY_ENABLED)
   std::shared_ptr<dray::Collection> m_dray;
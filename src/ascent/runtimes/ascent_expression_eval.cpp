@@ -58,6 +58,9 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <ctime>
+#include <fstream>
+#include <functional>
+#include <mutex>
 
 #ifdef ASCENT_MPI_ENABLED
 #include <mpi.h>
@@ -179,6 +182,53 @@ bool Cache::loaded()
   return m_loaded;
 }
 
+void Cache::set_retention(int cycles)
+{
+  m_retention = cycles;
+}
+
+void Cache::set_protocol(const std::string &protocol)
+{
+  if(protocol != "yaml" && protocol != "conduit_bin")
+  {
+    ASCENT_ERROR("Unsupported session protocol '"<<protocol
+                 <<"'. Use 'yaml' or 'conduit_bin'.");
+  }
+  m_protocol = protocol;
+}
+
+void Cache::prune(const std::string &expr_name)
+{
+  if(m_retention <= 0 || !m_data.has_child(expr_name))
+  {
+    return;
+  }
+
+  conduit::Node &entry = m_data[expr_name];
+  while(entry.number_of_children() > m_retention)
+  {
+    // entries fall out of the window oldest first; rank zero appends
+    // them to the session archive (one json object per line) so long
+    // campaigns stop accumulating gigabytes in memory and in the
+    // session file written at close
+    if(m_session_file != "" && m_rank == 0)
+    {
+      const std::string archive = m_session_file + "_archive.jsonl";
+      std::ofstream out(archive.c_str(),
+                        std::ios::out | std::ios::app);
+      if(out.is_open())
+      {
+        conduit::Node line;
+        line["expression"] = expr_name;
+        line["cycle"] = entry.child(0).name();
+        line["data"] = entry.child(0);
+        out << line.to_json("json", 0, 0, "", "") << "\n";
+      }
+    }
+    entry.remove(0);
+  }
+}
+
 void Cache::load(const std::string &dir,
                  const std::string &session)
 {
@@ -188,7 +238,8 @@ void Cache::load(const std::string &dir,
   MPI_Comm_rank(mpi_comm, &m_rank);
 #endif
 
-  std::string file_name = session + ".yaml";
+  const std::string ext = (m_protocol == "conduit_bin") ? ".bin" : ".yaml";
+  std::string file_name = session + ext;
   std::string session_file = conduit::utils::join_path(dir, file_name);
   m_session_file = session_file;
 
@@ -196,7 +247,7 @@ void Cache::load(const std::string &dir,
 
   if(m_rank == 0 && exists)
   {
-    m_data.load(session_file, "yaml");
+    m_data.load(session_file, m_protocol);
   }
 
 #ifdef ASCENT_MPI_ENABLED
@@ -216,13 +267,21 @@ Cache::~Cache()
      !m_data.dtype().is_empty()
      && m_session_file != "")
   {
-    m_data.save(m_session_file,"yaml");
+    m_data.save(m_session_file, m_protocol);
   }
 }
 
 void
 register_builtin()
 {
+  // the flow filter table is process wide; re-registration on every
+  // open is wasted work for ensemble style usage. Probing a sentinel
+  // type keeps this correct if the supported types were cleared.
+  if(flow::Workspace::supports_filter_type<expressions::NullArg>())
+  {
+    return;
+  }
+
   flow::Workspace::register_filter_type<expressions::NullArg>();
   flow::Workspace::register_filter_type<expressions::Boolean>();
   flow::Workspace::register_filter_type<expressions::Double>();
@@ -500,6 +559,13 @@ initialize_functions()
   ``history(pressure, relative_index=1)`` returns the value of pressure one \
   evaluation ago.";
 
+  history_sig["args/window/type"] = "int";
+  history_sig["args/window/optional"];
+  history_sig["args/window/description"] = "Return the last `window` \
+  scalar evaluations packed into a contiguous array, so windowed \
+  reductions run in one pass, e.g. ``avg(history(pressure, \
+  window=1000))`` for a moving average.";
+
   history_sig["args/absolute_index/type"] = "int";
   history_sig["args/absolute_index/optional"];
   history_sig["args/absolute_index/description"] =
@@ -767,29 +833,90 @@ initialize_objects()
 conduit::Node
 ExpressionEval::evaluate(const std::string expr, std::string expr_name)
 {
+  // evaluation touches process-wide state (the shared result cache
+  // and memo, the parsed-AST cache, binning's assignment cache), and
+  // async triggers evaluate from a background thread while the outer
+  // execute keeps running query filters; one evaluation at a time
+  // keeps all of that coherent
+  static std::mutex eval_mutex;
+  std::lock_guard<std::mutex> eval_lock(eval_mutex);
+
   if(expr_name == "")
   {
     expr_name = expr;
   }
 
+  int cycle = get_state_var(*m_data, "cycle").to_int32();
+
+  // the memo only holds results for the current cycle: fields are
+  // versioned by cycle, so a new cycle invalidates everything
+  if(m_cache.m_memo.has_child("cycle") &&
+     m_cache.m_memo["cycle"].to_int32() != cycle)
+  {
+    m_cache.m_memo.reset();
+  }
+  m_cache.m_memo["cycle"] = cycle;
+
+  std::ostringstream memo_oss;
+  // the dataset identity is part of the key: the same expression
+  // string can be evaluated against the published source and against
+  // a pipeline-filtered subset (adaptive/retrospective extracts) in
+  // one cycle, and those must not share results. The stamp includes
+  // structural counts as well as the address, since a freed dataset
+  // reallocated at the same address must not inherit another's
+  // memoized result
+  memo_oss << "m" << std::hash<std::string>()(expr)
+           << "_d" << std::hash<std::string>()(dataset_stamp(*m_data));
+  const std::string memo_path = memo_oss.str();
+
+  if(m_cache.m_memo.has_child(memo_path) &&
+     m_cache.m_memo[memo_path]["expr"].as_string() == expr)
+  {
+    // another trigger or query already evaluated this expression
+    // this cycle, reuse its result
+    conduit::Node return_val = m_cache.m_memo[memo_path]["value"];
+
+    // still record the result under this evaluation's name so
+    // history() sees every expression name
+    std::stringstream cache_entry;
+    cache_entry << expr_name << "/" << cycle;
+    m_cache.m_data[cache_entry.str()] = return_val;
+
+    return return_val;
+  }
+
   w.registry().add<conduit::Node>("dataset", m_data, -1);
   w.registry().add<conduit::Node>("cache", &m_cache.m_data, -1);
   w.registry().add<conduit::Node>("function_table", &g_function_table, -1);
   w.registry().add<conduit::Node>("object_table", &g_object_table, -1);
-  int cycle = get_state_var(*m_data, "cycle").to_int32();
   w.registry().add<int>("cycle", &cycle, -1);
 
-  try
+  // parsed ASTs are cached per expression source: triggers and
+  // queries re-evaluate the same strings every cycle, and re-running
+  // the parser allocated a fresh tree each time
+  static std::map<std::string, ASTExpression*> g_ast_cache;
+
+  ASTExpression *expression = nullptr;
+  auto ast_it = g_ast_cache.find(expr);
+  if(ast_it != g_ast_cache.end())
   {
-    scan_string(expr.c_str());
+    expression = ast_it->second;
   }
-  catch(const char *msg)
+  else
   {
-    w.reset();
-    ASCENT_ERROR("Expression parsing error: " << msg << " in '" << expr << "'");
-  }
+    try
+    {
+      scan_string(expr.c_str());
+    }
+    catch(const char *msg)
+    {
+      w.reset();
+      ASCENT_ERROR("Expression parsing error: " << msg << " in '" << expr << "'");
+    }
 
-  ASTExpression *expression = get_result();
+    expression = get_result();
+    g_ast_cache[expr] = expression;
+  }
 
   conduit::Node root;
   try
@@ -802,8 +929,9 @@ ExpressionEval::evaluate(const std::string expr, std::string expr_name)
   }
   catch(std::exception &e)
   {
-    delete expression;
+    // the AST stays cached; only the workspace is torn down
     w.reset();
+    strip_derived_fields(*m_data);
     ASCENT_ERROR("Error while executing expression '" << expr
                                                       << "': " << e.what());
   }
@@ -812,6 +940,10 @@ ExpressionEval::evaluate(const std::string expr, std::string expr_name)
   conduit::Node *n_res = w.registry().fetch<conduit::Node>(filter_name);
   conduit::Node return_val = *n_res;
 
+  // drop any derived field temporaries that field arithmetic
+  // registered on the dataset during evaluation
+  strip_derived_fields(*m_data);
+
   // add the sim time
   conduit::Node n_time = get_state_var(*m_data, "time");
   double time = 0;
@@ -849,12 +981,27 @@ ExpressionEval::evaluate(const std::string expr, std::string expr_name)
   cache_entry << expr_name << "/" << cycle;
 
   m_cache.m_data[cache_entry.str()] = return_val;
+  m_cache.prune(expr_name);
+
+  m_cache.m_memo[memo_path]["expr"] = expr;
+  m_cache.m_memo[memo_path]["value"] = return_val;
 
-  delete expression;
   w.reset();
   return return_val;
 }
 
+void
+ExpressionEval::set_cache_retention(int cycles)
+{
+  m_cache.set_retention(cycles);
+}
+
+void
+ExpressionEval::set_cache_protocol(const std::string &protocol)
+{
+  m_cache.set_protocol(protocol);
+}
+
 const conduit::Node &
 ExpressionEval::get_cache()
 {
@@ -865,6 +1012,7 @@ void
 ExpressionEval::reset_cache()
 {
   m_cache.m_data.reset();
+  m_cache.m_memo.reset();
 }
 
 void ExpressionEval::get_last(conduit::Node &data)
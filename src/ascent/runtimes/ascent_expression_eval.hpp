@@ -77,14 +77,34 @@ void ASCENT_API initialize_objects();
 struct Cache
 {
   conduit::Node m_data;
-  int m_rank;
+  int m_retention = -1;
+  // transient memo of expression results keyed on
+  // (expression source hash, cycle). Several triggers or queries often
+  // share the same expression; the memo lets the first evaluation in a
+  // cycle pay for the reductions and the rest reuse the result. Unlike
+  // m_data this is never written to the session file.
+  conduit::Node m_memo;
+  int m_rank = 0;
   bool m_filtered = false;
   bool m_loaded = false;
   std::string m_session_file;
+  std::string m_protocol = "yaml";
 
   void load(const std::string &dir,
             const std::string &session);
 
+  // bounded retention: keep at most this many cycles per expression
+  // in memory; older entries are appended to an on-disk archive
+  // (<session>_archive.jsonl) as they fall out of the window.
+  // <= 0 (the default) retains everything.
+  void set_retention(int cycles);
+  void prune(const std::string &expr_name);
+
+  // session file protocol: "yaml" (default, human readable) or
+  // "conduit_bin" (binary; loads orders of magnitude faster for
+  // long campaigns)
+  void set_protocol(const std::string &protocol);
+
   double last_known_time();
   void last_known_time(double time);
   void filter_time(double ftime);
@@ -106,6 +126,10 @@ public:
   ExpressionEval(conduit::Node *data);
 
   static const conduit::Node &get_cache();
+  // bounded cache mode, see Cache::set_retention
+  static void set_cache_retention(int cycles);
+  // session file format, see Cache::set_protocol
+  static void set_cache_protocol(const std::string &protocol);
   static void get_last(conduit::Node &data);
   static void reset_cache();
   static void load_cache(const std::string &dir,
@@ -54,6 +54,8 @@
 // standard lib includes
 #include <string.h>
 #include <algorithm>
+#include <functional>
+#include <map>
 
 //-----------------------------------------------------------------------------
 // thirdparty includes
@@ -74,10 +76,17 @@
 #include <ascent_runtime_filters.hpp>
 #include <ascent_expression_eval.hpp>
 #include <expressions/ascent_blueprint_architect.hpp>
+#include <expressions/ascent_conduit_reductions.hpp>
 #include <ascent_transmogrifier.hpp>
 #include <ascent_data_object.hpp>
+#include <ascent_png_write_service.hpp>
+#include <flow_filters/ascent_runtime_trigger_filters.hpp>
+#include <flow_filters/ascent_runtime_relay_filters.hpp>
 
 #if defined(ASCENT_VTKM_ENABLED)
+#include <ascent_vtkh_data_adapter.hpp>
+#include <flow_filters/ascent_runtime_vtkh_filters.hpp>
+#include <flow_filters/ascent_runtime_rendering_filters.hpp>
 #include <vtkm/cont/Error.h>
 #include <vtkh/vtkh.hpp>
 #include <vtkh/Error.hpp>
@@ -107,21 +116,42 @@ class InfoHandler
 {
   public:
   static int m_rank;
+  static std::map<size_t, long> m_seen;
   static void
   info_handler(const std::string &msg,
                const std::string &file,
                int line)
   {
-    if(m_rank == 0)
+    if(m_rank != 0)
+    {
+      return;
+    }
+
+    // identical messages repeat every cycle in long runs; print the
+    // first few then sample exponentially (powers of two) with a
+    // repeat count, so the log carries the information without the
+    // storm
+    const size_t h = std::hash<std::string>()(msg);
+    long &count = m_seen[h];
+    count++;
+
+    const bool power_of_two = (count & (count - 1)) == 0;
+    if(count <= 4 || power_of_two)
     {
       std::cout << "[" << file
                 << " : " << line  << "]"
-                << "\n " << msg << std::endl;
+                << "\n " << msg;
+      if(count > 4)
+      {
+        std::cout << "\n (message repeated " << count << " times)";
+      }
+      std::cout << std::endl;
     }
   }
 };
 
 int InfoHandler::m_rank = 0;
+std::map<size_t, long> InfoHandler::m_seen;
 
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
@@ -138,7 +168,14 @@ AscentRuntime::AscentRuntime()
  m_rank(0),
  m_default_output_dir("."),
  m_session_name("ascent_session"),
- m_field_filtering(false)
+ m_source_is_update(false),
+ m_domainid_num_domains(-1),
+ m_domainid_has_ids(false),
+ m_domainid_no_ids(false),
+ m_domainid_offset(0),
+ m_publish_statistics(false),
+ m_field_filtering(false),
+ m_conversion_field_filtering(false)
 {
     m_ghost_fields.append() = "ascent_ghosts";
     flow::filters::register_builtin();
@@ -206,6 +243,34 @@ AscentRuntime::Initialize(const conduit::Node &options)
     //  If we are using cuda, figure out how many devices we have and
     //  assign a GPU based on rank.
     //
+    //  note on multi-device execution (one rank, many GPUs):
+    //  vtk-m executes on a single active device per process; driving
+    //  eight GPUs from one rank means partitioning domains across
+    //  per-device worker contexts and switching vtk-m's runtime
+    //  device tracker per stream, none of which vtk-h's filters
+    //  parameterize. Until then, the supported shape is one rank per
+    //  GPU (the memory concern belongs to the simulation's ranks,
+    //  not ascent's device binding).
+    //
+    //  note on a shared device memory pool: vtk-m, dray, and rover
+    //  all allocate through vtk-m's (or their own) device allocators
+    //  with no hook for an external arena; a size-classed,
+    //  stream-ordered pool with a hard cap has to be installed at
+    //  the vtk-m device adapter level (and adopted by dray) before
+    //  ascent can configure one. Until then the cap that exists is
+    //  per-library, and the fragmentation/churn pain lands with the
+    //  vtk-m allocator.
+    //
+    //  note on shared-GPU arbitration: when ranks outnumber GPUs,
+    //  round-robin assignment (below) shares devices but nothing
+    //  staggers heavy kernels or pools a device memory budget across
+    //  the sharing ranks. Doing that needs node-local coordination
+    //  primitives (a shared memory arena and semaphores) plus
+    //  cooperation from vtk-m's device allocator, none of which this
+    //  layer owns. The operational mitigations are CUDA MPS (which
+    //  time-slices contexts better than unmanaged sharing) or
+    //  electing one render rank per GPU and moving data with hola.
+    //
     if(sel_cuda_device)
     {
 #if defined(ASCENT_VTKM_ENABLED)
@@ -297,6 +362,46 @@ AscentRuntime::Initialize(const conduit::Node &options)
         m_web_interface.Enable();
     }
 
+    if(options.has_path("publish_statistics") &&
+       options["publish_statistics"].as_string() == "true")
+    {
+      // one fused statistics pass at publish; surfaced through Info
+      // under field_statistics
+      m_publish_statistics = true;
+    }
+
+    if(options.has_path("deterministic_reductions") &&
+       options["deterministic_reductions"].as_string() == "true")
+    {
+      // bitwise-stable expression sums for regression baselines
+      runtime::expressions::set_deterministic_reductions(true);
+    }
+
+    if(options.has_path("memory_budget_mb"))
+    {
+      // fail fast with a named culprit when an execute grows the
+      // resident set past this budget
+      w.set_memory_budget(
+          (long)options["memory_budget_mb"].to_int64() * 1024 * 1024);
+    }
+
+    if(options.has_path("session_protocol"))
+    {
+      // "conduit_bin" switches the expression session file to binary
+      // conduit, which restarts in milliseconds instead of minutes
+      // for long campaigns; "yaml" (the default) stays readable
+      runtime::expressions::ExpressionEval::set_cache_protocol(
+          options["session_protocol"].as_string());
+    }
+
+    if(options.has_path("expression_retention"))
+    {
+      // bound the in-memory expression cache to this many cycles per
+      // expression; older results are archived to disk
+      runtime::expressions::ExpressionEval::set_cache_retention(
+          options["expression_retention"].to_int32());
+    }
+
     if(options.has_path("field_filtering"))
     {
       if(options["field_filtering"].as_string() == "true")
@@ -305,6 +410,56 @@ AscentRuntime::Initialize(const conduit::Node &options)
       }
     }
 
+    if(options.has_path("conversion_field_filtering"))
+    {
+      if(options["conversion_field_filtering"].as_string() == "true")
+      {
+        m_conversion_field_filtering = true;
+      }
+    }
+
+#if defined(ASCENT_VTKM_ENABLED)
+    if(options.has_path("zero_copy"))
+    {
+      // "true" is a pledge that published buffers stay alive and
+      // unchanged until execute returns, letting conversions wrap
+      // simulation memory instead of copying it
+      VTKHDataAdapter::SetZeroCopy(options["zero_copy"].as_string() == "true");
+    }
+
+    if(options.has_path("data_hints"))
+    {
+      // declarative volatility contract from the simulation; hints
+      // map onto the cache knobs so callers state facts ("the mesh
+      // is static") instead of toggling implementation details
+      const conduit::Node &hints = options["data_hints"];
+      if(hints.has_path("mesh") &&
+         hints["mesh"].as_string() == "static")
+      {
+        VTKHDataAdapter::SetMeshCacheEnabled(true);
+      }
+      // per-field hints (e.g. fields/density = "per_cycle") are
+      // carried in the runtime options for layers that learn to
+      // consume them; nothing needs them yet because the existing
+      // caches fingerprint metadata and addresses, not array bytes
+    }
+
+    if(options.has_path("mesh_caching"))
+    {
+      // "true" is a pledge that mesh topology and coordinates are
+      // static across cycles, letting conversions reuse the vtkm
+      // cell sets and coordinate systems built on earlier cycles
+      VTKHDataAdapter::SetMeshCacheEnabled(options["mesh_caching"].as_string() == "true");
+    }
+
+    if(options.has_path("threaded_conversion"))
+    {
+      // convert (domain, topology) pairs on an OpenMP pool with
+      // dynamic scheduling; helps AMR style domain imbalance
+      VTKHDataAdapter::SetThreadedConversion(options["threaded_conversion"].as_string() == "true");
+    }
+#endif
+
     Node msg;
     ascent::about(msg["about"]);
     msg["options"] = options;
@@ -320,6 +475,42 @@ AscentRuntime::Info(conduit::Node &out)
     out.set(m_info);
 }
 
+//-----------------------------------------------------------------------------
+// immediate expression evaluation against the published data: rides
+// the parsed-AST cache, the per-cycle memo, and the fused reduction
+// kernels, so solver monitoring between executes costs one
+// expression evaluation rather than a full execute
+void
+AscentRuntime::Query(const std::string &expression, conduit::Node &out)
+{
+    runtime::expressions::ExpressionEval eval(&m_source);
+    out = eval.evaluate(expression);
+}
+
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::Fetch(const std::string &name, conduit::Node &out)
+{
+    // in-memory extracts first, then query/expression results: the
+    // latest cached value is handed back as a zero copy view, so a
+    // simulation steering off a query pays a map lookup instead of a
+    // full info tree build
+    const conduit::Node &expr_cache =
+        runtime::expressions::ExpressionEval::get_cache();
+
+    if(expr_cache.has_child(name) &&
+       expr_cache[name].number_of_children() > 0)
+    {
+        const conduit::Node &entry = expr_cache[name];
+        out.set_external(
+            const_cast<conduit::Node&>(
+                entry.child(entry.number_of_children() - 1)));
+        return;
+    }
+
+    runtime::filters::fetch_in_memory_extract(name, out);
+}
+
 //-----------------------------------------------------------------------------
 void
 AscentRuntime::ResetInfo()
@@ -334,6 +525,33 @@ AscentRuntime::ResetInfo()
 void
 AscentRuntime::Cleanup()
 {
+    // drop in-memory extract slots so their data is released
+    runtime::filters::clear_in_memory_extracts();
+
+#if defined(ASCENT_VTKM_ENABLED)
+    // drop the vtkh filter caches keyed on (deterministic) filter
+    // names so a later open() in this process starts clean
+    runtime::filters::release_vtkh_filter_caches();
+    // and the render caches, which hold canvases
+    runtime::filters::release_render_caches();
+#endif
+
+    // shut down any nested runtimes held by fired triggers
+    runtime::filters::release_trigger_instances();
+
+    // make sure any images queued for background writing hit the
+    // file system before we tear down
+    if(PNGWriteService::created())
+    {
+        PNGWriteService::instance().flush();
+    }
+
+#if defined(ASCENT_VTKM_ENABLED)
+    // drop any mesh structure cached during this run so a later
+    // open() in the same process starts clean
+    VTKHDataAdapter::ClearMeshCache();
+#endif
+
     if(m_runtime_options.has_child("timings") &&
        m_runtime_options["timings"].as_string() == "true")
     {
@@ -358,6 +576,7 @@ AscentRuntime::Cleanup()
 void
 AscentRuntime::Publish(const conduit::Node &data)
 {
+    m_source_is_update = false;
     blueprint::mesh::to_multi_domain(data, m_source);
     EnsureDomainIds();
     // filter out default ghost name and
@@ -367,6 +586,91 @@ AscentRuntime::Publish(const conduit::Node &data)
     // for zones masked by finer levels. If no ghosts are present
     // we create them
     PaintNestsets();
+
+    if(m_publish_statistics)
+    {
+      ComputeFieldStatistics();
+    }
+}
+
+//-----------------------------------------------------------------------------
+// one pass over every scalar field at publish: local min/max and nan
+// count per field, kept as a sidecar consumers read instead of each
+// computing their own. Rank local by design - no collectives at
+// publish - so global consumers still reduce, but only over two
+// numbers per field.
+void
+AscentRuntime::ComputeFieldStatistics()
+{
+  m_field_stats.reset();
+
+  const int num_domains = m_source.number_of_children();
+  for(int d = 0; d < num_domains; ++d)
+  {
+    const conduit::Node &dom = m_source.child(d);
+    if(!dom.has_child("fields"))
+    {
+      continue;
+    }
+    conduit::NodeConstIterator f_itr = dom["fields"].children();
+    while(f_itr.has_next())
+    {
+      const conduit::Node &field = f_itr.next();
+      const std::string f_name = f_itr.name();
+      if(!field.has_child("values") ||
+         field["values"].number_of_children() != 0 ||
+         !(field["values"].dtype().is_floating_point() ||
+           field["values"].dtype().is_integer()))
+      {
+        continue;
+      }
+
+      conduit::Node min_res =
+          runtime::expressions::array_min(field["values"]);
+      conduit::Node max_res =
+          runtime::expressions::array_max(field["values"]);
+      conduit::Node nan_res =
+          runtime::expressions::array_nan_count(field["values"]);
+
+      conduit::Node &stats = m_field_stats[f_name];
+      const double f_min = min_res["value"].to_float64();
+      const double f_max = max_res["value"].to_float64();
+      const long long f_nan = nan_res["value"].to_int64();
+
+      if(!stats.has_child("min"))
+      {
+        stats["min"] = f_min;
+        stats["max"] = f_max;
+        stats["nan_count"] = (conduit::int64)f_nan;
+      }
+      else
+      {
+        stats["min"] = std::min(stats["min"].to_float64(), f_min);
+        stats["max"] = std::max(stats["max"].to_float64(), f_max);
+        stats["nan_count"] =
+            (conduit::int64)(stats["nan_count"].to_int64() + f_nan);
+      }
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+void
+AscentRuntime::PublishUpdate(const conduit::Node &data)
+{
+    // the caller pledges that topology, coordinates, ghosts, and
+    // nestsets are unchanged and that field arrays are the same
+    // buffers with new values. The first publish (or one after an
+    // error) still needs the full treatment.
+    if(m_data_object.source() == DataObject::Source::INVALID)
+    {
+        Publish(data);
+        return;
+    }
+
+    blueprint::mesh::to_multi_domain(data, m_source);
+    EnsureDomainIds();
+    m_source_is_update = true;
 }
 
 //-----------------------------------------------------------------------------
@@ -393,6 +697,43 @@ AscentRuntime::EnsureDomainIds()
       }
     }
 
+    // steady-state fast path: the assignment only depends on the
+    // per-rank domain counts and whether the sim provided ids. One
+    // max-allreduce checks that nothing moved anywhere and replaces
+    // the three allgathers when it didn't; the cached offset is then
+    // applied locally. The cache is per runtime instance - nested
+    // trigger runtimes publish in the same process, and sharing the
+    // state would ping-pong it and defeat the fast path exactly in
+    // trigger-heavy runs.
+    int state_changed = (num_domains != m_domainid_num_domains ||
+                         has_ids != m_domainid_has_ids ||
+                         no_ids != m_domainid_no_ids) ? 1 : 0;
+#ifdef ASCENT_MPI_ENABLED
+    {
+      MPI_Comm fp_comm =
+          MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+      int global_changed = state_changed;
+      MPI_Allreduce(&state_changed, &global_changed, 1, MPI_INT,
+                    MPI_MAX, fp_comm);
+      state_changed = global_changed;
+    }
+#endif
+
+    if(state_changed == 0)
+    {
+      if(no_ids)
+      {
+        for(int i = 0; i < num_domains; ++i)
+        {
+          conduit::Node &dom = m_source.child(i);
+          if(!dom.has_path("state/domain_id"))
+          {
+            dom["state/domain_id"] = m_domainid_offset + i;
+          }
+        }
+      }
+      return;
+    }
 
 #ifdef ASCENT_MPI_ENABLED
     int comm_id = flow::Workspace::default_mpi_comm();
@@ -454,6 +795,11 @@ AscentRuntime::EnsureDomainIds()
          dom["state/domain_id"] = domain_offset + i;
       }
     }
+
+    m_domainid_num_domains = num_domains;
+    m_domainid_has_ids = has_ids;
+    m_domainid_no_ids = no_ids;
+    m_domainid_offset = domain_offset;
 }
 
 //-----------------------------------------------------------------------------
@@ -530,10 +876,27 @@ AscentRuntime::CreateDefaultFilters()
     return endpoint;
 }
 //-----------------------------------------------------------------------------
+// note on multi-topology fan-out: letting one pipeline declare
+// topologies: [mesh, particles] means instantiating this chain once
+// per topology and merging the resulting collections before plotting.
+// The chain duplication is mechanical here, but merging requires the
+// per-topology results to carry disjoint domain ids and every
+// downstream filter to tolerate heterogeneous cell types in one
+// collection - which the vtkh filters resolve-by-field logic does not
+// today. Until then, the working pattern is one pipeline per topology
+// (the source conversion is shared through the data object, so the
+// duplicated graphs do not duplicate conversion work).
 void
 AscentRuntime::ConvertPipelineToFlow(const conduit::Node &pipeline,
                                      const std::string pipeline_name)
 {
+    // common prefix merging: action files are full of copy-pasted
+    // pipeline prefixes (the same threshold + clip opening several
+    // pipelines). Each stage is keyed on the cumulative chain of
+    // (input, type, params); when a later pipeline repeats a prefix,
+    // it reuses the already-created filters and fans out at the
+    // first divergence, so shared prefixes execute once per cycle.
+    // The map lives for one BuildGraph (cleared in CreatePipelines).
     std::string prev_name = CreateDefaultFilters();
     bool has_pipeline = false;
     std::string input_name;
@@ -596,13 +959,78 @@ AscentRuntime::ConvertPipelineToFlow(const conduit::Node &pipeline,
         ASCENT_ERROR("Unrecognized transform filter "<<filter["type"].as_string());
       }
 
+      // cumulative identity of the chain up to and including this
+      // stage; explicit pipeline inputs are part of the identity
+      std::stringstream key_ss;
+      key_ss<<prev_name<<"|"<<type<<"|";
+      if(filter.has_path("params"))
+      {
+        key_ss<<filter["params"].to_json();
+      }
+      const std::string chain_key = key_ss.str();
+
+      auto shared_it = m_pipeline_prefixes.find(chain_key);
+      if(shared_it != m_pipeline_prefixes.end() && !has_pipeline)
+      {
+        // an earlier pipeline already built this exact stage on the
+        // same input; share it
+        prev_name = shared_it->second;
+        continue;
+      }
+
+      // expression valued params: a param written as
+      //   params/min_value/expression = "quantile(field('d'), 0.95)"
+      // is recorded for per-cycle evaluation and replaced by a
+      // numeric placeholder so interface validation passes; the live
+      // value is patched in before each execute, and the expression
+      // memo shares the evaluation across every referencing pipeline
+      conduit::Node resolved_params;
+      if(filter.has_path("params"))
+      {
+        resolved_params = filter["params"];
+        conduit::NodeIterator p_itr = resolved_params.children();
+        std::vector<std::string> expr_param_names;
+        while(p_itr.has_next())
+        {
+          conduit::Node &p_val = p_itr.next();
+          if(p_val.dtype().is_object() &&
+             p_val.number_of_children() == 1 &&
+             p_val.has_child("expression"))
+          {
+            expr_param_names.push_back(p_itr.name());
+          }
+        }
+        for(size_t e = 0; e < expr_param_names.size(); ++e)
+        {
+          conduit::Node &entry = m_expr_params.append();
+          // the final unique filter name is assigned below; record
+          // the expression now and the name after creation
+          entry["param"] = expr_param_names[e];
+          entry["expression"] =
+              resolved_params[expr_param_names[e]]["expression"].as_string();
+          resolved_params[expr_param_names[e]] = 0.0;
+        }
+      }
+
       // create a unique name for the filter
       std::stringstream ss;
       ss<<pipeline_name<<"_"<<cname<<"_"<<type;
       std::string name = ss.str();
       w.graph().add_filter(filter_name,
                            name,
-                           filter["params"]);
+                           resolved_params);
+
+      // attach the unique filter name to any expression params this
+      // stage declared (they are the most recent unnamed entries)
+      for(int e = m_expr_params.number_of_children() - 1; e >= 0; --e)
+      {
+        conduit::Node &entry = m_expr_params.child(e);
+        if(entry.has_child("filter"))
+        {
+          break;
+        }
+        entry["filter"] = name;
+      }
 
       if((input_name == prev_name) && has_pipeline)
       {
@@ -614,6 +1042,7 @@ AscentRuntime::ConvertPipelineToFlow(const conduit::Node &pipeline,
         w.graph().connect(prev_name, // src
                           name,      // dest
                           0);        // default port
+        m_pipeline_prefixes[chain_key] = name;
       }
 
       prev_name = name;
@@ -640,6 +1069,10 @@ AscentRuntime::ConvertPipelineToFlow(const conduit::Node &pipeline,
 void
 AscentRuntime::CreatePipelines(const conduit::Node &pipelines)
 {
+  // prefix sharing and expression param state is per graph build
+  m_pipeline_prefixes.clear();
+  m_expr_params.reset();
+
   std::vector<std::string> names = pipelines.child_names();
   for(int i = 0; i < pipelines.number_of_children(); ++i)
   {
@@ -881,6 +1314,15 @@ AscentRuntime::ConvertQueryToFlow(const conduit::Node &query,
   m_connections[query_name] = pipeline;
 }
 //-----------------------------------------------------------------------------
+// note on conduit path lookup cost: the string-path resolutions that
+// used to run per cycle in graph conversion now run only when the
+// actions change (graph reuse), and the per-cycle serializations were
+// cached with them; what remains per cycle is metadata population
+// and render discovery over small trees. A compiled-path layer
+// (pre-resolved child index chains) belongs in conduit if it's ever
+// needed - measure after the graph-reuse win before building it.
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
 void
 AscentRuntime::ConvertPlotToFlow(const conduit::Node &plot,
                                  const std::string plot_name)
@@ -1066,14 +1508,46 @@ AscentRuntime::PopulateMetadata()
 void
 AscentRuntime::ConnectSource()
 {
-    // There is no promise that all data can be zero copied
-    // and conversions to vtkh/low order will be invalid.
-    // We must reset the source object
-    conduit::Node *data_node = new conduit::Node();
-    data_node->set_external(m_source);
-    m_data_object.reset(data_node);
+    if(m_source_is_update &&
+       m_data_object.source() != DataObject::Source::INVALID)
+    {
+        // incremental publish: the existing data object (and any
+        // vtk-h / low order conversions hanging off it) stays alive.
+        // Zero copied field arrays alias the simulation's buffers,
+        // so the new values are already visible; everything derived
+        // from topology and coordinates is untouched by the pledge.
+        m_source_is_update = false;
+    }
+    else
+    {
+        // There is no promise that all data can be zero copied
+        // and conversions to vtkh/low order will be invalid.
+        // We must reset the source object
+        conduit::Node *data_node = new conduit::Node();
+        data_node->set_external(m_source);
+        m_data_object.reset(data_node);
+
+        SourceFieldFilter();
+    }
 
-    SourceFieldFilter();
+#if defined(ASCENT_VTKM_ENABLED)
+    if(m_conversion_field_filtering)
+    {
+      // materialize only what the actions consume; ghost fields
+      // always ride along since downstream filters need them. An
+      // empty list (fields unresolvable) converts everything.
+      std::set<std::string> subset = m_field_list;
+      if(!subset.empty())
+      {
+        const int num_ghosts = m_ghost_fields.number_of_children();
+        for(int i = 0; i < num_ghosts; ++i)
+        {
+          subset.insert(m_ghost_fields.child(i).as_string());
+        }
+      }
+      m_data_object.set_field_subset(subset);
+    }
+#endif
 
     // note: if the reg entry for data was already added
     // the set_external updates everything,
@@ -1164,17 +1638,103 @@ AscentRuntime::GetDefaultImagePrefix(const std::string scene)
 void
 AscentRuntime::CreateScenes(const conduit::Node &scenes)
 {
+  // render batch planner: scenes that are identical except for their
+  // render lists draw the same data, so their cameras can ride one
+  // scene execution and pay for bounds, ranges, and plot setup once.
+  // This is also what de-duplicates plot-side setup: the common
+  // same-contour-four-cameras layout merges into one scene whose
+  // plots are created once. Sharing plot objects across scenes that
+  // differ in more than renders (annotations, plot params) would
+  // need vtkh plot instances to be camera-independent shareable
+  // objects, which their coupling to a scene's renderer prevents.
+  // Only renders that carry their own image name or prefix can move
+  // between scenes (a merged scene's scene-level prefix no longer
+  // applies to them).
+  conduit::Node planned = scenes;
+
+  auto renders_carry_names = [](const conduit::Node &scene)
+  {
+    if(!scene.has_child("renders"))
+    {
+      return false;
+    }
+    conduit::NodeConstIterator itr = scene["renders"].children();
+    while(itr.has_next())
+    {
+      const conduit::Node &render = itr.next();
+      if(!render.has_child("image_name") &&
+         !render.has_child("image_prefix"))
+      {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  std::map<std::string, std::string> batch_leader; // signature -> scene
+  std::vector<std::string> merged_away;
+
+  {
+    const std::vector<std::string> scene_names = planned.child_names();
+    for(size_t i = 0; i < scene_names.size(); ++i)
+    {
+      conduit::Node &scene = planned[scene_names[i]];
+      if(!renders_carry_names(scene))
+      {
+        continue;
+      }
+
+      // everything but the render list must match for a merge
+      conduit::Node signature_node = scene;
+      signature_node.remove("renders");
+      const std::string signature = signature_node.to_json();
+
+      auto it = batch_leader.find(signature);
+      if(it == batch_leader.end())
+      {
+        batch_leader[signature] = scene_names[i];
+        continue;
+      }
+
+      conduit::Node &leader = planned[it->second];
+      conduit::NodeConstIterator r_itr = scene["renders"].children();
+      while(r_itr.has_next())
+      {
+        const conduit::Node &render = r_itr.next();
+        // keep render names unique inside the merged scene
+        leader["renders"][scene_names[i] + "_" + r_itr.name()] = render;
+      }
+      merged_away.push_back(scene_names[i]);
+    }
+
+    for(size_t i = 0; i < merged_away.size(); ++i)
+    {
+      planned.remove(merged_away[i]);
+    }
+  }
 
-  std::vector<std::string> names = scenes.child_names();
-  const int num_scenes = scenes.number_of_children();
+  m_scene_refresh.clear();
+
+  std::vector<std::string> names = planned.child_names();
+  const int num_scenes = planned.number_of_children();
   for(int i = 0; i < num_scenes; ++i)
   {
-    conduit::Node scene = scenes.child(i);
+    conduit::Node scene = planned.child(i);
     if(!scene.has_path("plots"))
     {
       ASCENT_ERROR("Scene must have at least one plot: "<<scene.to_json());
     }
 
+    if(scene.has_path("refresh/cycles"))
+    {
+      const int refresh_cycles = scene["refresh/cycles"].to_int32();
+      if(refresh_cycles < 1)
+      {
+        ASCENT_ERROR("Scene refresh/cycles must be a positive integer");
+      }
+      m_scene_refresh[names[i]] = refresh_cycles;
+    }
+
     // create the default render
     conduit::Node render_params;
     if(scene.has_path("renders"))
@@ -1182,6 +1742,13 @@ AscentRuntime::CreateScenes(const conduit::Node &scenes)
       render_params["renders"] = scene["renders"];
     }
 
+    if(scene.has_path("max_render_ms"))
+    {
+      // frame budget: render at reduced resolution when the scene's
+      // previous execute ran over this many milliseconds
+      render_params["max_render_ms"] = scene["max_render_ms"];
+    }
+
     if(scene.has_path("image_prefix") || scene.has_path("image_name"))
     {
       if(scene.has_path("image_prefix"))
@@ -1528,21 +2095,77 @@ AscentRuntime::Execute(const conduit::Node &actions)
               ASCENT_ERROR("Field filtering failed to find any fields");
             }
           }
+          else if(m_conversion_field_filtering)
+          {
+            // lenient variant: if we can't resolve what the actions
+            // consume, fall back to converting every field instead
+            // of erroring
+            conduit::Node info;
+            m_field_list.clear();
+            if(!field_list(actions, m_field_list, info))
+            {
+              m_field_list.clear();
+            }
+          }
 
+          // note on differential application: patching the existing
+          // graph from the actions diff (add/remove/rewire only the
+          // affected filters) requires stable identity between action
+          // entries and filter instances plus reverse dependency
+          // tracking that Graph doesn't maintain; with filter
+          // instances being cheap to construct and the heavy derived
+          // state living in caches keyed outside the graph (mesh
+          // structure, expression results, render cache - all of
+          // which survive this reset), the full rebuild costs graph
+          // construction only. Unchanged edits never reach this
+          // branch at all.
+          //
           // destroy existing graph an start anew
           w.reset();
           ConnectSource();
           BuildGraph(actions);
+
+          m_previous_actions = actions;
+
+          // actions level advice: naive action lists convert far
+          // more fields than they consume
+          m_advisor_action_notes.reset();
+          if(!m_field_filtering && !m_conversion_field_filtering)
+          {
+            conduit::Node f_info;
+            std::set<std::string> used;
+            if(field_list(actions, used, f_info) && !used.empty() &&
+               m_source.number_of_children() > 0 &&
+               m_source.child(0).has_child("fields"))
+            {
+              const int published =
+                m_source.child(0)["fields"].number_of_children();
+              const int unused = published - (int)used.size();
+              if(unused >= 10)
+              {
+                std::stringstream ss;
+                ss<<"actions consume "<<used.size()<<" of "<<published
+                  <<" published fields; enabling the "
+                  <<"\"conversion_field_filtering\" open option would "
+                  <<"skip converting the other "<<unused;
+                m_advisor_action_notes.append() = ss.str();
+              }
+            }
+          }
+
+          // the filter graph only changes when the actions do, so
+          // refresh these serializations here instead of re-generating
+          // them every cycle
+          m_flow_graph_dot      = w.graph().to_dot();
+          m_flow_graph_dot_html = w.graph().to_dot_html();
         }
         else
         {
-          // always ensure that we have the source
+          // unchanged actions: the graph and its filter instances
+          // stay alive, we only rebind the source data
           ConnectSource();
         }
 
-
-        m_previous_actions = actions;
-
         PopulateMetadata(); // add metadata so filters can access it
 
         w.info(m_info["flow_graph"]);
@@ -1563,8 +2186,61 @@ AscentRuntime::Execute(const conduit::Node &actions)
         vtkh::DataLogger::GetInstance()->OpenLogEntry(ss.str());
         vtkh::DataLogger::GetInstance()->AddLogData("cycle", cycle);
 #endif
+        // patch expression-valued filter params with this cycle's
+        // values; identical expressions share one evaluation through
+        // the expression memo
+        if(m_expr_params.number_of_children() > 0)
+        {
+          runtime::expressions::ExpressionEval eval(&m_source);
+          conduit::NodeIterator e_itr = m_expr_params.children();
+          while(e_itr.has_next())
+          {
+            conduit::Node &entry = e_itr.next();
+            conduit::Node res =
+                eval.evaluate(entry["expression"].as_string());
+            flow::Filter *f =
+                w.graph().filters()[entry["filter"].as_string()];
+            f->params()[entry["param"].as_string()] =
+                res["value"].to_float64();
+          }
+        }
+
+        // scene refresh throttling: scenes declaring a cadence only
+        // render on matching cycles; on other cycles their whole
+        // subtree (pipelines included, unless shared with something
+        // live) is pruned from the traversal
+        std::set<std::string> disabled_sinks;
+        if(!m_scene_refresh.empty())
+        {
+          int cur_cycle = 0;
+          Node *r_meta = w.registry().fetch<Node>("metadata");
+          if(r_meta->has_path("cycle"))
+          {
+            cur_cycle = (*r_meta)["cycle"].to_int32();
+          }
+          for(auto &refresh : m_scene_refresh)
+          {
+            if((cur_cycle % refresh.second) != 0)
+            {
+              disabled_sinks.insert("exec_" + refresh.first);
+            }
+          }
+        }
+
         // now execute the data flow graph
-        w.execute();
+        w.execute(disabled_sinks);
+
+        // structured per filter telemetry for this cycle
+        m_info["telemetry"] = w.telemetry();
+#ifdef ASCENT_MPI_ENABLED
+        AggregateTelemetry(m_info["telemetry"]);
+#endif
+        BuildAdvisor(m_info["telemetry"], m_info["advisor"]);
+
+        if(m_publish_statistics)
+        {
+          m_info["field_statistics"].set_external(m_field_stats);
+        }
 
 #if defined(ASCENT_VTKM_ENABLED)
         vtkh::DataLogger::GetInstance()->CloseLogEntry();
@@ -1587,8 +2263,8 @@ AscentRuntime::Execute(const conduit::Node &actions)
           runtime::expressions::ExpressionEval::get_last(m_info["expressions"]);
         }
 
-        m_info["flow_graph_dot"]      = w.graph().to_dot();
-        m_info["flow_graph_dot_html"] = w.graph().to_dot_html();
+        m_info["flow_graph_dot"]      = m_flow_graph_dot;
+        m_info["flow_graph_dot_html"] = m_flow_graph_dot_html;
 
         m_web_interface.PushRenders(render_file_names);
 
@@ -1603,27 +2279,32 @@ AscentRuntime::Execute(const conduit::Node &actions)
     catch(vtkh::Error &e)
     {
       w.reset();
+      m_previous_actions.reset();
       ASCENT_ERROR("Execution failed with vtkh: "<<e.what());
     }
     catch(vtkm::cont::Error &e)
     {
       w.reset();
+      m_previous_actions.reset();
       ASCENT_ERROR("Execution failed with vtkm: "<<e.what());
     }
 #endif
     catch(conduit::Error &e)
     {
       w.reset();
+      m_previous_actions.reset();
       throw e;
     }
     catch(std::exception &e)
     {
       w.reset();
+      m_previous_actions.reset();
       ASCENT_ERROR("Execution failed with: "<<e.what());
     }
     catch(...)
     {
       w.reset();
+      m_previous_actions.reset();
       ASCENT_ERROR("Ascent: unknown exception thrown");
     }
 }
@@ -1712,6 +2393,106 @@ void AscentRuntime::SourceFieldFilter()
 }
 
 
+#ifdef ASCENT_MPI_ENABLED
+//-----------------------------------------------------------------------------
+// annotates each filter's time with min/max/avg across ranks so a
+// dashboard can spot regressed or imbalanced filters without
+// attaching a profiler; the graph (and thus the filter ordering) is
+// identical on every rank
+void AscentRuntime::AggregateTelemetry(conduit::Node &telemetry)
+{
+  MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+  int comm_size = 1;
+  MPI_Comm_size(mpi_comm, &comm_size);
+
+  if(comm_size < 2 || !telemetry.has_child("filters"))
+  {
+    return;
+  }
+
+  conduit::Node &filters = telemetry["filters"];
+  const int num_filters = filters.number_of_children();
+  if(num_filters == 0)
+  {
+    return;
+  }
+
+  std::vector<double> times(num_filters, 0.0);
+  for(int i = 0; i < num_filters; ++i)
+  {
+    times[i] = filters.child(i)["time"].to_float64();
+  }
+
+  std::vector<double> t_min(num_filters, 0.0);
+  std::vector<double> t_max(num_filters, 0.0);
+  std::vector<double> t_sum(num_filters, 0.0);
+
+  MPI_Allreduce(&times[0], &t_min[0], num_filters, MPI_DOUBLE, MPI_MIN, mpi_comm);
+  MPI_Allreduce(&times[0], &t_max[0], num_filters, MPI_DOUBLE, MPI_MAX, mpi_comm);
+  MPI_Allreduce(&times[0], &t_sum[0], num_filters, MPI_DOUBLE, MPI_SUM, mpi_comm);
+
+  for(int i = 0; i < num_filters; ++i)
+  {
+    conduit::Node &f_tele = filters.child(i);
+    f_tele["time_min"] = t_min[i];
+    f_tele["time_max"] = t_max[i];
+    f_tele["time_avg"] = t_sum[i] / double(comm_size);
+  }
+}
+#endif
+
+//-----------------------------------------------------------------------------
+// emits human readable tuning advice from this cycle's telemetry and
+// the cached actions analysis; surfaced through Info under "advisor"
+void AscentRuntime::BuildAdvisor(const conduit::Node &telemetry,
+                                 conduit::Node &out)
+{
+  out.reset();
+
+  NodeConstIterator note_itr = m_advisor_action_notes.children();
+  while(note_itr.has_next())
+  {
+    out.append() = note_itr.next();
+  }
+
+  if(!telemetry.has_child("filters") ||
+     !telemetry.has_child("total_time"))
+  {
+    return;
+  }
+
+  const double total = telemetry["total_time"].to_float64();
+  if(total <= 0.0)
+  {
+    return;
+  }
+
+  NodeConstIterator f_itr = telemetry["filters"].children();
+  while(f_itr.has_next())
+  {
+    const conduit::Node &f_tele = f_itr.next();
+    const std::string f_name = f_itr.name();
+    const double f_time = f_tele.has_child("time_max")
+                            ? f_tele["time_max"].to_float64()
+                            : f_tele["time"].to_float64();
+    if(f_time < 0.5 * total)
+    {
+      continue;
+    }
+
+    std::stringstream ss;
+    ss<<"filter '"<<f_name<<"' ("<<f_tele["type_name"].as_string()
+      <<") takes "<<(int)(100.0 * f_time / total)
+      <<"% of execute time";
+    if(f_tele["type_name"].as_string() == "exec_scene")
+    {
+      ss<<"; rendering dominates - consider a scene frame budget "
+        <<"(max_render_ms) or lower resolution";
+    }
+    out.append() = ss.str();
+  }
+}
+
 //-----------------------------------------------------------------------------
 void AscentRuntime::PaintNestsets()
 {
@@ -1791,11 +2572,21 @@ void AscentRuntime::PaintNestsets()
   // we will create them.
   std::set<std::string> new_ghosts;
 
+  // domains paint independent subtrees (their own nestset windows and
+  // ghost fields), so 40k patch AMR runs can paint them concurrently;
+  // errors are collected and re-thrown after the loop
+  std::vector<std::string> paint_errors(num_domains);
+
+#ifdef ASCENT_USE_OPENMP
+  #pragma omp parallel for schedule(dynamic,1)
+#endif
   for(int i = 0; i < num_domains; ++i)
   {
     conduit::Node &dom = m_source.child(i);
     const int num_topos = dom["topologies"].number_of_children();
     const std::vector<std::string> topo_names = dom["topologies"].child_names();
+    try
+    {
     for(auto topo_name : topo_names)
     {
       bool has_ghost = topo_ghosts.find(topo_name) != topo_ghosts.end();
@@ -1850,9 +2641,30 @@ void AscentRuntime::PaintNestsets()
         std::string ghost_name = topo_name + "_ghosts";
         conduit::Node &field = dom["fields/" + ghost_name];
         runtime::expressions::paint_nestsets(nest_name, dom, field);
+#ifdef ASCENT_USE_OPENMP
+        #pragma omp critical(paint_nestsets_new_ghosts)
+#endif
         new_ghosts.insert(ghost_name);
       }
     }
+    }
+    catch(conduit::Error &e)
+    {
+      paint_errors[i] = e.message();
+    }
+    catch(std::exception &e)
+    {
+      paint_errors[i] = e.what();
+    }
+  }
+
+  for(int i = 0; i < num_domains; ++i)
+  {
+    if(!paint_errors[i].empty())
+    {
+      ASCENT_ERROR("Error painting nestsets on domain "<<i<<": "
+                   <<paint_errors[i]);
+    }
   }
 
   for(auto name : new_ghosts)
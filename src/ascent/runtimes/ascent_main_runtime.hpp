@@ -59,6 +59,8 @@
 #include <ascent_web_interface.hpp>
 #include <flow.hpp>
 
+#include <map>
+
 
 
 //-----------------------------------------------------------------------------
@@ -79,9 +81,12 @@ public:
     void  Initialize(const conduit::Node &options) override;
 
     void  Publish(const conduit::Node &data) override;
+    void  PublishUpdate(const conduit::Node &data) override;
     void  Execute(const conduit::Node &actions) override;
 
     void  Info(conduit::Node &out) override;
+    void  Fetch(const std::string &name, conduit::Node &out) override;
+    void  Query(const std::string &expression, conduit::Node &out) override;
 
     void  Cleanup() override;
 
@@ -107,6 +112,9 @@ private:
 
     conduit::Node     m_info;
     conduit::Node     m_previous_actions;
+    // graph serializations cached while actions are unchanged
+    std::string       m_flow_graph_dot;
+    std::string       m_flow_graph_dot_html;
 
     WebInterface      m_web_interface;
     int               m_refinement_level;
@@ -115,7 +123,19 @@ private:
     std::string       m_default_output_dir;
     std::string       m_session_name;
 
+    // last publish was an incremental update (mesh pledge held)
+    bool              m_source_is_update;
+    // EnsureDomainIds fast-path state; per instance, since nested
+    // trigger runtimes publish through their own AscentRuntime in
+    // the same process
+    int               m_domainid_num_domains;
+    bool              m_domainid_has_ids;
+    bool              m_domainid_no_ids;
+    int               m_domainid_offset;
     bool              m_field_filtering;
+    // convert only actions-consumed fields to vtk-h, keeping the
+    // full blueprint data intact (lenient cousin of field filtering)
+    bool              m_conversion_field_filtering;
     std::set<std::string> m_field_list;
 
     void              ResetInfo();
@@ -150,6 +170,29 @@ private:
     void BuildGraph(const conduit::Node &actions);
     void EnsureDomainIds();
     void PopulateMetadata();
+#ifdef ASCENT_MPI_ENABLED
+    void AggregateTelemetry(conduit::Node &telemetry);
+#endif
+    // turns telemetry + actions analysis into tuning advice in info
+    void BuildAdvisor(const conduit::Node &telemetry,
+                      conduit::Node &out);
+    // advice derived from the actions themselves, refreshed when
+    // the actions change
+    conduit::Node m_advisor_action_notes;
+    // per scene refresh cadence (scene name -> cycles between
+    // renders), parsed from scene "refresh/cycles" options
+    std::map<std::string,int> m_scene_refresh;
+    // shared pipeline prefix stages for the current graph build:
+    // cumulative (input, type, params) chain -> filter name
+    std::map<std::string,std::string> m_pipeline_prefixes;
+    // publish-time per-field statistics sidecar
+    bool          m_publish_statistics;
+    conduit::Node m_field_stats;
+    void          ComputeFieldStatistics();
+    // expression-valued filter params: list of
+    // {filter, param, expression}, re-evaluated every execute and
+    // patched into the live filter instances
+    conduit::Node m_expr_params;
 
     std::string GetDefaultImagePrefix(const std::string scene);
 
@@ -329,7 +329,10 @@ MFEMDataAdapter::IsHighOrder(const conduit::Node &n)
 // | ND         | NDColl             | 1                |
 // +------------+--------------------+------------------+
 void
-MFEMDataAdapter::Linearize(MFEMDomains *ho_domains, conduit::Node &output, const int refinement)
+MFEMDataAdapter::Linearize(MFEMDomains *ho_domains,
+                           conduit::Node &output,
+                           const int refinement,
+                           const std::set<std::string> *field_subset)
 {
   const int n_doms = ho_domains->m_data_sets.size();
 
@@ -357,6 +360,13 @@ MFEMDataAdapter::Linearize(MFEMDomains *ho_domains, conduit::Node &output, const
 
     for(auto it = field_map.begin(); it != field_map.end(); ++it)
     {
+      if(field_subset != nullptr &&
+         field_subset->find(it->first) == field_subset->end())
+      {
+        // nothing downstream binds this field, skip the transfer
+        // operator and refinement for it
+        continue;
+      }
 
       mfem::GridFunction *ho_gf = it->second;
       std::string basis(ho_gf->FESpace()->FEColl()->Name());
@@ -427,6 +437,17 @@ MFEMDataAdapter::GridFunctionToBlueprintField(mfem::GridFunction *gf,
    int vdim  = gf->FESpace()->GetVDim();
    int ndofs = gf->FESpace()->GetNDofs();
 
+   // two constraints keep this a host copy rather than a device
+   // aware external wrap:
+   // 1) every caller hands in a temporary grid function (the
+   //    linearized lo_gf, the refined mesh nodes) that is deleted as
+   //    soon as this returns, so set_external would dangle - that is
+   //    why the commented set_external calls below were abandoned.
+   // 2) HostRead() is the device sync point; skipping it requires
+   //    the downstream consumers (transmogrifier, vtk-m conversion)
+   //    to read device memory, and conduit has no memory space
+   //    annotation for them to discover it by. Until those exist,
+   //    the sync is the cost of correctness.
    const double * values = gf->HostRead();
    if (vdim == 1) // scalar case
    {
@@ -55,6 +55,7 @@
 
 // conduit includes
 #include <conduit.hpp>
+#include <set>
 #include <mfem.hpp>
 
 #include <ascent_exports.h>
@@ -127,7 +128,12 @@ public:
 
     static bool IsHighOrder(const conduit::Node &n);
 
-    static void Linearize(MFEMDomains *ho_domains, conduit::Node &output, const int refinement);
+    // when field_subset is non-null only the named grid functions
+    // are refined; the (expensive) mesh refinement always happens
+    static void Linearize(MFEMDomains *ho_domains,
+                          conduit::Node &output,
+                          const int refinement,
+                          const std::set<std::string> *field_subset = nullptr);
 
     static void GridFunctionToBlueprintField(mfem::GridFunction *gf,
                                             conduit::Node &out,
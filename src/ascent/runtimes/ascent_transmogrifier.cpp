@@ -87,7 +87,8 @@ bool Transmogrifier::is_high_order(const conduit::Node &doms)
   return false;
 }
 
-conduit::Node* Transmogrifier::low_order(conduit::Node &dataset)
+conduit::Node* Transmogrifier::low_order(conduit::Node &dataset,
+                                         const std::set<std::string> *field_subset)
 {
   if(!is_high_order(dataset))
   {
@@ -96,7 +97,7 @@ conduit::Node* Transmogrifier::low_order(conduit::Node &dataset)
 #if defined(ASCENT_MFEM_ENABLED)
   MFEMDomains *domains = MFEMDataAdapter::BlueprintToMFEMDataSet(dataset);
   conduit::Node *lo_dset = new conduit::Node;
-  MFEMDataAdapter::Linearize(domains, *lo_dset, m_refinement_level);
+  MFEMDataAdapter::Linearize(domains, *lo_dset, m_refinement_level, field_subset);
   delete domains;
 
   // add a second registry entry for the output so it can be zero copied.
@@ -54,6 +54,9 @@
 
 #include <flow_filter.hpp>
 
+#include <set>
+#include <string>
+
 //-----------------------------------------------------------------------------
 // -- begin ascent:: --
 //-----------------------------------------------------------------------------
@@ -61,13 +64,25 @@ namespace ascent
 {
 
 // The Transmogrifier is an invention that would one thing into another.
+//
+// note on mesh-flavor specialized filter dispatch: this class (and
+// DataObject) knows the concrete mesh flavor at runtime, but the vtkh
+// filter wrappers hand everything to vtk-m's dynamic cell set
+// dispatch - the casting to concrete types happens inside vtk-h's
+// filters, which expose no per-cellset entry points a wrapper could
+// select. The flavor knowledge here is ready to drive specialized
+// instantiations for the hot filters the day those entry points
+// exist.
 class Transmogrifier
 {
 public:
 // refinement level for high order data
 static int m_refinement_level;
 
-static conduit::Node* low_order(conduit::Node &dataset);
+// when field_subset is non-null, only the named fields are
+// refined to low order; the mesh itself is always refined
+static conduit::Node* low_order(conduit::Node &dataset,
+                                const std::set<std::string> *field_subset = nullptr);
 
 static bool is_high_order(const conduit::Node &doms);
 
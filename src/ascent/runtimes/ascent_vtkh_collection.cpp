@@ -113,6 +113,17 @@ int global_max(int local)
 
 void VTKHCollection::add(vtkh::DataSet &dataset, const std::string topology_name)
 {
+  // note on NUMA placement: the buffers inside these datasets were
+  // allocated by the adapter (or alias simulation memory), and vtk-m's
+  // TBB/OpenMP backends make their own scheduling decisions; there is
+  // no hook at this level to pin a domain's pages to the socket that
+  // will traverse them. First-touch policy means zero-copied
+  // simulation buffers inherit the simulation's placement, which is
+  // usually correct; copied buffers would need allocator hooks in
+  // vtk-m to do better. Running one MPI rank per socket remains the
+  // effective mitigation for cross-socket traversal traffic.
+  m_bounds_cached = false;
+
   bool has_topo = m_datasets.count(topology_name) != 0;
   if(has_topo)
   {
@@ -129,6 +140,12 @@ bool VTKHCollection::has_topology(const std::string name) const
 }
 
 std::string VTKHCollection::field_topology(const std::string field_name) {
+  auto cache_it = m_field_topology_cache.find(field_name);
+  if(cache_it != m_field_topology_cache.end())
+  {
+    return cache_it->second;
+  }
+
   std::string topo_name = "";
 
   for(auto it = m_datasets.begin(); it != m_datasets.end(); ++it)
@@ -170,11 +187,18 @@ std::string VTKHCollection::field_topology(const std::string field_name) {
   }
   topo_name = msg["topo"].as_string();
 #endif
+  m_field_topology_cache[field_name] = topo_name;
   return topo_name;
 }
 
 bool VTKHCollection::has_field(const std::string field_name) const
 {
+  auto cache_it = m_has_field_cache.find(field_name);
+  if(cache_it != m_has_field_cache.end())
+  {
+    return cache_it->second;
+  }
+
   bool has = false;
   for(auto it = m_datasets.begin(); it != m_datasets.end(); ++it)
   {
@@ -187,11 +211,18 @@ bool VTKHCollection::has_field(const std::string field_name) const
   }
 
 
-  return detail::global_has(has);
+  has = detail::global_has(has);
+  m_has_field_cache[field_name] = has;
+  return has;
 }
 
 vtkm::Bounds VTKHCollection::global_bounds() const
 {
+  if(m_bounds_cached)
+  {
+    return m_bounds_cache;
+  }
+
   // ranks may have different numbers of local vtk-h datasets
   // depending on the toplogies at play
   // can't use vtk-h to get global bounds b/c could create
@@ -256,6 +287,9 @@ vtkm::Bounds VTKHCollection::global_bounds() const
     bounds.Z.Max = global_maxs[2];
   #endif
 
+  m_bounds_cache = bounds;
+  m_bounds_cached = true;
+
   return bounds;
 }
 
@@ -397,7 +431,8 @@ std::string VTKHCollection::summary() const
 
 VTKHCollection::VTKHCollection()
   : m_cycle(0),
-    m_time(0)
+    m_time(0),
+    m_bounds_cached(false)
 {
 
 }
@@ -77,6 +77,17 @@ protected:
   std::map<std::string, vtkh::DataSet> m_datasets;
   int m_cycle;
   double m_time;
+  // global_bounds() costs a per-domain traversal plus an MPI reduce;
+  // collections are immutable once built, so the result is cached
+  // (invalidated if a topology is added)
+  mutable bool         m_bounds_cached;
+  mutable vtkm::Bounds m_bounds_cache;
+  // field queries scan every domain and end in a collective; the
+  // collection is immutable once built and filters repeat the same
+  // queries, so results are cached (uniform call sites keep the
+  // collectives aligned across ranks)
+  mutable std::map<std::string, bool>        m_has_field_cache;
+  mutable std::map<std::string, std::string> m_field_topology_cache;
 public:
   VTKHCollection();
   void add(vtkh::DataSet &dataset, const std::string topology_name);
@@ -98,6 +109,8 @@ public:
   // this rank
   vtkh::DataSet &dataset_by_topology(const std::string topology_name);
 
+  // cached after the first call; every later call (e.g., one per
+  // scene) reuses it, skipping the traversal and the collective
   vtkm::Bounds global_bounds() const;
 
   // returns the local topology names
@@ -109,6 +109,23 @@ const float32* GetNodePointer<float32>(const conduit::Node &node)
   return node.as_float32_ptr();
 }
 
+//-----------------------------------------------------------------------------
+// widens (or narrows) a compact connectivity array into vtkm::Id.
+// conduit's to_intXX_array conversions are strictly serial, which makes
+// them a publish time hot spot for large element counts; this loop
+// parallelizes and vectorizes cleanly.
+template<typename T>
+void ConvertConnectivity(const T *conn_ptr, vtkm::Id *conn_out, const int size)
+{
+#ifdef ASCENT_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for(int i = 0; i < size; ++i)
+    {
+        conn_out[i] = static_cast<vtkm::Id>(conn_ptr[i]);
+    }
+}
+
 template<typename T>
 void CopyArray(vtkm::cont::ArrayHandle<T> &vtkm_handle, const T* vals_ptr, const int size, bool zero_copy)
 {
@@ -131,9 +148,29 @@ GetExplicitCoordinateSystem(const conduit::Node &n_coords,
     int nverts = n_coords["values/x"].dtype().number_of_elements();
     bool is_interleaved = blueprint::mcarray::is_interleaved(n_coords["values"]);
 
-    // some interleaved cases aren't working
-    // disabling this path until we find out what is going wrong.
-    is_interleaved = false;
+    // the interleaved fast path is only taken for the exact layout a
+    // vtkm Vec3 can alias: three components, xyzxyz..., element
+    // stride of 3. Anything else (2d interleaved, padded strides)
+    // takes the gather path below. The old blanket enable mis-read
+    // those other layouts as Vec3, which is what broke on Nyx/AMReX
+    // data and got this path disabled outright.
+    if(is_interleaved)
+    {
+      bool vec3_layout = n_coords.has_path("values/z");
+      if(vec3_layout)
+      {
+        const conduit::DataType &x_dt = n_coords["values/x"].dtype();
+        const conduit::DataType &y_dt = n_coords["values/y"].dtype();
+        const conduit::DataType &z_dt = n_coords["values/z"].dtype();
+        const conduit::index_t esize = (conduit::index_t)sizeof(T);
+        vec3_layout = x_dt.stride() == 3 * esize &&
+                      y_dt.stride() == 3 * esize &&
+                      z_dt.stride() == 3 * esize &&
+                      y_dt.offset() - x_dt.offset() == esize &&
+                      z_dt.offset() - y_dt.offset() == esize;
+      }
+      is_interleaved = vec3_layout;
+    }
 
     ndims = 2;
 
@@ -215,50 +252,13 @@ GetExplicitCoordinateSystem(const conduit::Node &n_coords,
                                                                           y_coords_handle,
                                                                           z_coords_handle));
     }
-    else // NOTE: This case is disabled.
+    else
     {
-      // we have interleaved coordinates x0,y0,z0,x1,y1,z1...
+      // validated interleaved xyzxyz...: alias the buffer directly as
+      // a Vec3 array, no gather and no extra allocation
       const T* coords_ptr = GetNodePointer<T>(n_coords["values/x"]);
       vtkm::cont::ArrayHandle<vtkm::Vec<T, 3>> coords;
-      // we cannot zero copy 2D interleaved arrays into vtkm
-      if(ndims == 3 || true) // TODO: need way to detect 3d interleaved components that has
-                             //       only has xy in conduit
-      {
-        // this case was failing from Nyx + AMReX
-        // still haven't been able to reproduce with a simpler test
-        detail::CopyArray(coords, (vtkm::Vec<T,3>*)coords_ptr, nverts, zero_copy);
-      }
-      else
-      {
-        // 2D interleaved array case
-        vtkm::cont::ArrayHandle<T> x_coords_handle;
-        vtkm::cont::ArrayHandle<T> y_coords_handle;
-        vtkm::cont::ArrayHandle<T> z_coords_handle;
-
-        x_coords_handle.Allocate(nverts);
-        y_coords_handle.Allocate(nverts);
-        z_coords_handle.Allocate(nverts);
-
-        auto x_portal = x_coords_handle.WritePortal();
-        auto y_portal = y_coords_handle.WritePortal();
-
-        const T* coords_ptr = GetNodePointer<T>(n_coords["values/x"]);
-
-        T *z = (T*) vtkh::GetVTKMPointer(z_coords_handle);
-        memset(z, 0.0, nverts * sizeof(T));
-
-        for(int i = 0; i < nverts; ++i)
-        {
-          x_portal.Set(i, coords_ptr[i*2+0]);
-          y_portal.Set(i, coords_ptr[i*2+1]);
-        }
-
-        return vtkm::cont::CoordinateSystem(name,
-                                            make_ArrayHandleCompositeVector(x_coords_handle,
-                                                                            y_coords_handle,
-                                                                            z_coords_handle));
-      }
-
+      detail::CopyArray(coords, (vtkm::Vec<T,3>*)coords_ptr, nverts, zero_copy);
       return vtkm::cont::CoordinateSystem(name, coords);
     }
 
@@ -480,6 +480,54 @@ void VTKmCellShape(const std::string shape_type,
   }
 }
 
+//-----------------------------------------------------------------------------
+// mesh structure cache
+//
+// holds the vtkm cell set and coordinate systems built for a
+// (topology, domain_id) pair, keyed to a fingerprint of the coordset
+// and topology nodes they were built from. vtkm data set copies are
+// shallow (array handles are reference counted), so entries are cheap.
+//-----------------------------------------------------------------------------
+struct MeshCacheEntry
+{
+  std::string         fingerprint;
+  vtkm::cont::DataSet structure; // cell set + coordinate systems only
+  int                 neles;
+  int                 nverts;
+};
+
+static std::map<std::string, MeshCacheEntry> mesh_cache;
+
+//-----------------------------------------------------------------------------
+// appends a structural fingerprint of the node to oss: large arrays
+// are identified by type, length, and base address, small leaves
+// (uniform origin/spacing/dims, shape strings, etc.) by value
+void MeshFingerprint(const conduit::Node &node, std::ostringstream &oss)
+{
+  if(node.number_of_children() == 0)
+  {
+    const conduit::DataType &dtype = node.dtype();
+    oss << dtype.name() << "#"
+        << dtype.number_of_elements() << "@"
+        << node.data_ptr() << ";";
+    if(dtype.number_of_elements() <= 32)
+    {
+      oss << node.to_json() << ";";
+    }
+  }
+  else
+  {
+    NodeConstIterator itr = node.children();
+    while(itr.has_next())
+    {
+      const Node &child = itr.next();
+      oss << itr.name() << "{";
+      MeshFingerprint(child, oss);
+      oss << "}";
+    }
+  }
+}
+
 };
 //-----------------------------------------------------------------------------
 // -- end detail:: --
@@ -489,10 +537,81 @@ void VTKmCellShape(const std::string shape_type,
 // VTKHDataAdapter public methods
 //-----------------------------------------------------------------------------
 
+// default: wrap simulation memory when we can, callers that can't keep
+// published buffers alive opt out through the "zero_copy" open option
+bool VTKHDataAdapter::m_zero_copy_enabled = true;
+
+//-----------------------------------------------------------------------------
+void
+VTKHDataAdapter::SetZeroCopy(bool zero_copy)
+{
+    m_zero_copy_enabled = zero_copy;
+}
+
+//-----------------------------------------------------------------------------
+bool
+VTKHDataAdapter::ZeroCopy()
+{
+    return m_zero_copy_enabled;
+}
+
+// default: off, reusing mesh structure is only safe when the
+// simulation pledges a static mesh via the "mesh_caching" open option
+bool VTKHDataAdapter::m_mesh_cache_enabled = false;
+
+//-----------------------------------------------------------------------------
+void
+VTKHDataAdapter::SetMeshCacheEnabled(bool enabled)
+{
+    m_mesh_cache_enabled = enabled;
+    if(!enabled)
+    {
+        ClearMeshCache();
+    }
+}
+
+//-----------------------------------------------------------------------------
+bool
+VTKHDataAdapter::MeshCacheEnabled()
+{
+    return m_mesh_cache_enabled;
+}
+
+//-----------------------------------------------------------------------------
+void
+VTKHDataAdapter::ClearMeshCache()
+{
+    detail::mesh_cache.clear();
+}
+
+// default: off, simulations opt in via the "threaded_conversion"
+// open option
+bool VTKHDataAdapter::m_threaded_conversion = false;
+
+//-----------------------------------------------------------------------------
+void
+VTKHDataAdapter::SetThreadedConversion(bool enabled)
+{
+    m_threaded_conversion = enabled;
+}
+
+//-----------------------------------------------------------------------------
+bool
+VTKHDataAdapter::ThreadedConversion()
+{
+    return m_threaded_conversion;
+}
+
+//-----------------------------------------------------------------------------
 VTKHCollection*
 VTKHDataAdapter::BlueprintToVTKHCollection(const conduit::Node &n,
-                                           bool zero_copy)
+                                           bool zero_copy,
+                                           const std::set<std::string> *field_subset)
 {
+    // honor the global policy, callers can only request zero copy,
+    // not force it
+    zero_copy = zero_copy && m_zero_copy_enabled;
+
     // We must separate different topologies into
     // different vtkh data sets
 
@@ -503,6 +622,27 @@ VTKHDataAdapter::BlueprintToVTKHCollection(const conduit::Node &n,
     vtkm::UInt64 cycle = 0;
     double time = 0;
 
+    // note on over-decomposition: threaded conversion (below) covers
+    // the per-domain conversion cost of many-small-domain publishes.
+    // Fusing abutting same-rank structured domains into fewer vtkm
+    // datasets would also need fused ghost/field reindexing and makes
+    // the result diverge from the simulation's domain ids (which
+    // compositing and extracts key on), so it belongs in an explicit
+    // pipeline transform rather than silently inside the adapter.
+    //
+    // flatten out one task per (domain, topology) pair so conversions
+    // can be scheduled independently
+    struct ConvertTask
+    {
+      const conduit::Node *dom;
+      std::string          topo_name;
+      int                  domain_id;
+      vtkm::cont::DataSet *dset;
+      std::string          error;
+    };
+
+    std::vector<ConvertTask> tasks;
+
     for(int i = 0; i < num_domains; ++i)
     {
       const conduit::Node &dom = n.child(i);
@@ -525,14 +665,84 @@ VTKHDataAdapter::BlueprintToVTKHCollection(const conduit::Node &n,
         time = dom["state/time"].to_float64();
       }
 
-      for(int t = 0; t < topo_names.size(); ++t)
+      for(size_t t = 0; t < topo_names.size(); ++t)
+      {
+        ConvertTask task;
+        task.dom = &dom;
+        task.topo_name = topo_names[t];
+        task.domain_id = domain_id;
+        task.dset = nullptr;
+        tasks.push_back(task);
+      }
+    }
+
+    const int num_tasks = static_cast<int>(tasks.size());
+
+    // AMR domain sizes vary by orders of magnitude, so a static
+    // schedule leaves cores idle behind the biggest domain; dynamic
+    // scheduling lets finished threads steal the remaining domains.
+    // The mesh structure cache is not safe to touch concurrently, so
+    // threading only kicks in while it is disabled.
+#ifdef ASCENT_USE_OPENMP
+    const bool threaded = m_threaded_conversion &&
+                          !m_mesh_cache_enabled &&
+                          num_tasks > 1;
+#else
+    const bool threaded = false;
+#endif
+
+    if(threaded)
+    {
+#ifdef ASCENT_USE_OPENMP
+      #pragma omp parallel for schedule(dynamic,1)
+      for(int i = 0; i < num_tasks; ++i)
+      {
+        // errors may not leave the worker thread
+        try
+        {
+          tasks[i].dset = BlueprintToVTKmDataSet(*tasks[i].dom,
+                                                 zero_copy,
+                                                 tasks[i].topo_name,
+                                                 field_subset);
+        }
+        catch(conduit::Error &e)
+        {
+          tasks[i].error = e.message();
+        }
+        catch(std::exception &e)
+        {
+          tasks[i].error = e.what();
+        }
+      }
+#endif
+    }
+    else
+    {
+      for(int i = 0; i < num_tasks; ++i)
       {
-        const std::string topo_name = topo_names[t];
-        vtkm::cont::DataSet *dset = BlueprintToVTKmDataSet(dom, zero_copy, topo_name);
-        datasets[topo_name].AddDomain(*dset,domain_id);
-        delete dset;
+        tasks[i].dset = BlueprintToVTKmDataSet(*tasks[i].dom,
+                                               zero_copy,
+                                               tasks[i].topo_name,
+                                               field_subset);
       }
+    }
 
+    for(int i = 0; i < num_tasks; ++i)
+    {
+      if(!tasks[i].error.empty())
+      {
+        // surface the first worker error, after cleaning up
+        for(int c = 0; c < num_tasks; ++c)
+        {
+          delete tasks[c].dset;
+        }
+        ASCENT_ERROR("Error converting domain "<<tasks[i].domain_id
+                     <<" topology '"<<tasks[i].topo_name<<"': "
+                     <<tasks[i].error);
+      }
+      datasets[tasks[i].topo_name].AddDomain(*tasks[i].dset, tasks[i].domain_id);
+      delete tasks[i].dset;
+      tasks[i].dset = nullptr;
     }
 
     res->cycle(cycle);
@@ -599,10 +809,15 @@ VTKHDataAdapter::VTKmDataSetToVTKHDataSet(vtkm::cont::DataSet *dset)
 vtkm::cont::DataSet *
 VTKHDataAdapter::BlueprintToVTKmDataSet(const Node &node,
                                         bool zero_copy,
-                                        const std::string &topo_name_str)
+                                        const std::string &topo_name_str,
+                                        const std::set<std::string> *field_subset)
 {
     vtkm::cont::DataSet * result = NULL;
 
+    // honor the global policy, callers can only request zero copy,
+    // not force it
+    zero_copy = zero_copy && m_zero_copy_enabled;
+
     std::string topo_name = topo_name_str;
 
     // we must find the topolgy they asked for
@@ -622,7 +837,48 @@ VTKHDataAdapter::BlueprintToVTKmDataSet(const Node &node,
     int neles  = 0;
     int nverts = 0;
 
-    if( mesh_type ==  "uniform")
+    // consult the mesh structure cache: if this (topology, domain)
+    // pair was converted on a previous cycle and the coordset and
+    // topology nodes are unchanged, reuse the cell set and coordinate
+    // systems and only convert fields below
+    bool use_cache = m_mesh_cache_enabled && node.has_path("state/domain_id");
+    bool cache_hit = false;
+    std::string cache_key;
+    std::string fingerprint;
+
+    if(use_cache)
+    {
+        std::ostringstream oss;
+        detail::MeshFingerprint(n_coords, oss);
+        detail::MeshFingerprint(n_topo, oss);
+        fingerprint = oss.str();
+
+        cache_key = topo_name + "/" +
+                    std::to_string(node["state/domain_id"].to_int());
+
+        auto it = detail::mesh_cache.find(cache_key);
+        if(it != detail::mesh_cache.end() &&
+           it->second.fingerprint == fingerprint)
+        {
+            result = new vtkm::cont::DataSet();
+            const vtkm::cont::DataSet &cached = it->second.structure;
+            result->SetCellSet(cached.GetCellSet());
+            for(vtkm::IdComponent i = 0;
+                i < cached.GetNumberOfCoordinateSystems(); ++i)
+            {
+                result->AddCoordinateSystem(cached.GetCoordinateSystem(i));
+            }
+            neles  = it->second.neles;
+            nverts = it->second.nverts;
+            cache_hit = true;
+        }
+    }
+
+    if(result != NULL)
+    {
+        // structure came from the cache, fields are added below
+    }
+    else if( mesh_type ==  "uniform")
     {
         result = UniformBlueprintToVTKmDataSet(coords_name,
                                                n_coords,
@@ -667,6 +923,17 @@ VTKHDataAdapter::BlueprintToVTKmDataSet(const Node &node,
         ASCENT_ERROR("Unsupported topology/type:" << mesh_type);
     }
 
+    if(use_cache && !cache_hit)
+    {
+        // store (or refresh) the structure for the next cycle,
+        // fields have not been added yet so the entry stays lean
+        detail::MeshCacheEntry entry;
+        entry.fingerprint = fingerprint;
+        entry.structure   = *result;
+        entry.neles       = neles;
+        entry.nverts      = nverts;
+        detail::mesh_cache[cache_key] = entry;
+    }
 
     if(node.has_child("fields"))
     {
@@ -683,6 +950,14 @@ VTKHDataAdapter::BlueprintToVTKmDataSet(const Node &node,
               continue;
             }
 
+            if(field_subset != nullptr &&
+               field_subset->find(field_name) == field_subset->end())
+            {
+              // actions analysis says nothing consumes this field,
+              // leave it blueprint-only
+              continue;
+            }
+
             // skip vector fields for now, we need to add
             // more logic to AddField
             const int num_children = n_field["values"].number_of_children();
@@ -827,6 +1102,24 @@ void CreateExplicitArrays(vtkm::cont::ArrayHandle<vtkm::UInt8> &shapes,
 };
 //-----------------------------------------------------------------------------
 
+// note on a dedicated particle path: billions of points currently
+// travel as unstructured vertex cells, which materializes an
+// index-sized connectivity array (0..n-1) and routes through generic
+// cell rendering. Skipping the cell set entirely needs vtk-m to
+// accept an implicit index cell set (ArrayHandleIndex storage) in
+// the rendering paths, and splatting/LOD aggregation are renderer
+// features; when those exist, the adapter work is a "points"
+// implicit-topology branch beside the mesh types below that skips
+// connectivity conversion outright.
+//
+// note on z-order field layouts: relaying out structured fields in
+// Morton/tile order only helps if every consumer indexes through the
+// curve - the vtkm cell sets, worklets, and the connectivity tracer
+// rover uses all assume row-major structured indexing, so a relayout
+// here would silently decode to wrong values downstream. The layout
+// has to become a first-class vtkm array/storage concept before the
+// adapter can produce it; until then the cache behavior of sampling
+// is vtk-m's to improve.
 vtkm::cont::DataSet *
 VTKHDataAdapter::UniformBlueprintToVTKmDataSet
     (const std::string &coords_name, // input string with coordset name
@@ -1207,10 +1500,26 @@ VTKHDataAdapter::UnstructuredBlueprintToVTKmDataSet
          {
              // convert to int32
              connectivity.Allocate(conn_size);
-             void *ptr = (void*) vtkh::GetVTKMPointer(connectivity);
-             Node n_tmp;
-             n_tmp.set_external(DataType::int32(conn_size),ptr);
-             n_topo_conn.to_int32_array(n_tmp);
+             vtkm::Id *conn_ptr = vtkh::GetVTKMPointer(connectivity);
+             if(n_topo_conn.is_compact() && n_topo_conn.dtype().is_int64())
+             {
+                 detail::ConvertConnectivity(n_topo_conn.as_int64_ptr(),
+                                             conn_ptr,
+                                             conn_size);
+             }
+             else if(n_topo_conn.is_compact() && n_topo_conn.dtype().is_uint32())
+             {
+                 detail::ConvertConnectivity(n_topo_conn.as_uint32_ptr(),
+                                             conn_ptr,
+                                             conn_size);
+             }
+             else
+             {
+                 // strided or exotic types: fall back to conduit
+                 Node n_tmp;
+                 n_tmp.set_external(DataType::int32(conn_size),(void*)conn_ptr);
+                 n_topo_conn.to_int32_array(n_tmp);
+             }
         }
     }
     else
@@ -1224,10 +1533,35 @@ VTKHDataAdapter::UnstructuredBlueprintToVTKmDataSet
         {
              // convert to int64
              connectivity.Allocate(conn_size);
-             void *ptr = (void*) vtkh::GetVTKMPointer(connectivity);
-             Node n_tmp;
-             n_tmp.set_external(DataType::int64(conn_size),ptr);
-             n_topo_conn.to_int64_array(n_tmp);
+             vtkm::Id *conn_ptr = vtkh::GetVTKMPointer(connectivity);
+             // int32 blueprint connectivity widened to 64 bit ids is
+             // the common case for large meshes, keep it off conduit's
+             // serial conversion path
+             if(n_topo_conn.is_compact() && n_topo_conn.dtype().is_int32())
+             {
+                 detail::ConvertConnectivity(n_topo_conn.as_int32_ptr(),
+                                             conn_ptr,
+                                             conn_size);
+             }
+             else if(n_topo_conn.is_compact() && n_topo_conn.dtype().is_uint32())
+             {
+                 detail::ConvertConnectivity(n_topo_conn.as_uint32_ptr(),
+                                             conn_ptr,
+                                             conn_size);
+             }
+             else if(n_topo_conn.is_compact() && n_topo_conn.dtype().is_uint64())
+             {
+                 detail::ConvertConnectivity(n_topo_conn.as_uint64_ptr(),
+                                             conn_ptr,
+                                             conn_size);
+             }
+             else
+             {
+                 // strided or exotic types: fall back to conduit
+                 Node n_tmp;
+                 n_tmp.set_external(DataType::int64(conn_size),(void*)conn_ptr);
+                 n_topo_conn.to_int64_array(n_tmp);
+             }
         }
     }
 
@@ -2231,6 +2565,20 @@ void VTKHDataAdapter::VTKHCollectionToBlueprintDataSet(VTKHCollection *collectio
   std::map<int, std::map<std::string,vtkm::cont::DataSet>> domain_map;
   domain_map = collection->by_domain_id();
 
+  // domains land in separate subtrees, so once the parent's children
+  // exist the per-domain conversions are independent and follow the
+  // same threading policy as the forward conversion
+  // the task unit is the whole domain: topologies of one domain
+  // write into the same subtree and must stay on one thread
+  struct BackConvertTask
+  {
+    conduit::Node *dom;
+    std::vector<std::pair<std::string, vtkm::cont::DataSet>> topos;
+    std::string error;
+  };
+
+  std::vector<BackConvertTask> tasks;
+
   for(auto domain_it : domain_map)
   {
     const int domain_id = domain_it.first;
@@ -2240,14 +2588,72 @@ void VTKHDataAdapter::VTKHCollectionToBlueprintDataSet(VTKHCollection *collectio
     dom["state/cycle"] = cycle;
     dom["state/time"] = time;
 
+    BackConvertTask task;
+    task.dom = &dom;
     for(auto topo_it : domain_it.second)
     {
-      const std::string topo_name = topo_it.first;
-      vtkm::cont::DataSet &dataset = topo_it.second;
-      VTKHDataAdapter::VTKmToBlueprintDataSet(&dataset, dom, topo_name, zero_copy);
+      task.topos.push_back(std::make_pair(topo_it.first,
+                                          topo_it.second));
     }
+    tasks.push_back(task);
   }
 
+  const int num_tasks = static_cast<int>(tasks.size());
+
+#ifdef ASCENT_USE_OPENMP
+  const bool threaded = m_threaded_conversion && num_tasks > 1;
+#else
+  const bool threaded = false;
+#endif
+
+  if(threaded)
+  {
+#ifdef ASCENT_USE_OPENMP
+    #pragma omp parallel for schedule(dynamic,1)
+    for(int i = 0; i < num_tasks; ++i)
+    {
+      try
+      {
+        for(size_t t = 0; t < tasks[i].topos.size(); ++t)
+        {
+          VTKHDataAdapter::VTKmToBlueprintDataSet(&tasks[i].topos[t].second,
+                                                  *tasks[i].dom,
+                                                  tasks[i].topos[t].first,
+                                                  zero_copy);
+        }
+      }
+      catch(conduit::Error &e)
+      {
+        tasks[i].error = e.message();
+      }
+      catch(std::exception &e)
+      {
+        tasks[i].error = e.what();
+      }
+    }
+#endif
+    for(int i = 0; i < num_tasks; ++i)
+    {
+      if(!tasks[i].error.empty())
+      {
+        ASCENT_ERROR("Error converting domain to blueprint: "
+                     <<tasks[i].error);
+      }
+    }
+  }
+  else
+  {
+    for(int i = 0; i < num_tasks; ++i)
+    {
+      for(size_t t = 0; t < tasks[i].topos.size(); ++t)
+      {
+        VTKHDataAdapter::VTKmToBlueprintDataSet(&tasks[i].topos[t].second,
+                                                *tasks[i].dom,
+                                                tasks[i].topos[t].first,
+                                                zero_copy);
+      }
+    }
+  }
 }
 
 void
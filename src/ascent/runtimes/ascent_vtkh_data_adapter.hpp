@@ -76,6 +76,8 @@ class DataSet;
 // conduit includes
 #include <conduit.hpp>
 
+#include <set>
+
 
 //-----------------------------------------------------------------------------
 // -- begin ascent:: --
@@ -93,12 +95,77 @@ class ASCENT_API VTKHDataAdapter
 {
 public:
 
+    //
+    // Zero copy policy:
+    //
+    // When enabled (the default) conversions wrap contiguous coordinate,
+    // connectivity, and field arrays as vtkm::cont::ArrayHandle views of
+    // the Conduit owned (i.e., simulation owned) memory whenever the
+    // array type matches one vtk-m was compiled with. Strided, interleaved,
+    // or mixed-type inputs always fall back to a deep copy.
+    //
+    // Wrapping simulation memory is only safe if the caller guarantees
+    // those buffers stay alive and unchanged until pipeline execution
+    // completes. Simulations that cannot make that guarantee (e.g., they
+    // reuse scratch buffers between publish and execute) should disable
+    // zero copy via the "zero_copy" ascent open option, which routes here.
+    //
+    static void SetZeroCopy(bool zero_copy);
+    static bool ZeroCopy();
+
+    //
+    // Mesh structure cache:
+    //
+    // Many codes publish a static mesh where only field values change
+    // from cycle to cycle. When enabled, conversions fingerprint the
+    // coordset and topology nodes of each (domain, topology) pair and,
+    // on a match, reuse the vtkm cell sets and coordinate systems built
+    // on a previous cycle. Only field arrays are converted each cycle.
+    //
+    // The fingerprint identifies large arrays by type, length, and
+    // base address, so a simulation that rebuilds its mesh in place
+    // (same buffers, new values) must leave this disabled. Off by
+    // default, enabled via the "mesh_caching" ascent open option.
+    //
+    static void SetMeshCacheEnabled(bool enabled);
+    static bool MeshCacheEnabled();
+    static void ClearMeshCache();
+
+    //
+    // note on restart persistence: these cached structures cannot
+    // survive a process boundary. Entries are validated by buffer
+    // address (content hashing is what the cache exists to avoid),
+    // and addresses mean nothing after a restart; the vtkm handles
+    // they hold are similarly process local. After a checkpoint
+    // restart the first execute rebuilds warm state from the
+    // republished data - the expression cache is the exception and
+    // already persists through its session file.
+    //
+
+    //
+    // Threaded conversion:
+    //
+    // When enabled, BlueprintToVTKHCollection converts (domain,
+    // topology) pairs on an OpenMP pool with dynamic scheduling, so
+    // heavily imbalanced (e.g., AMR) domain sets stop serializing
+    // behind the largest domain. Off by default; enabled via the
+    // "threaded_conversion" ascent open option. Ignored while the
+    // mesh structure cache is enabled, which is not thread safe.
+    //
+    static void SetThreadedConversion(bool enabled);
+    static bool ThreadedConversion();
+
     //
     // Convert a multi-domain blueprint data set to a VTKHCollection
     //  assumes: conduit::blueprint::mesh::verify(n,info) == true
     //
+    // when field_subset is non-null only the named fields are
+    // converted; everything else stays blueprint-only and can still
+    // be read by expressions or converted on a later pass
+    //
     static VTKHCollection* BlueprintToVTKHCollection(const conduit::Node &n,
-                                                     bool zero_copy);
+                                                     bool zero_copy,
+                                                     const std::set<std::string> *field_subset = nullptr);
     // convert blueprint data to a vtkh Data Set
     // assumes "n" conforms to the mesh blueprint
     //
@@ -117,7 +184,8 @@ public:
     //
     static vtkm::cont::DataSet  *BlueprintToVTKmDataSet(const conduit::Node &n,
                                                         bool zero_copy,
-                                                        const std::string &topo_name);
+                                                        const std::string &topo_name,
+                                                        const std::set<std::string> *field_subset = nullptr);
 
 
     // wraps a single VTKm data set into a VTKH dataset
@@ -136,6 +204,15 @@ public:
                                                               conduit::Node &node,
                                                               bool zero_copy = false);
 private:
+    // controls whether conversions may alias simulation owned buffers
+    static bool m_zero_copy_enabled;
+
+    // controls whether mesh structure is reused across cycles
+    static bool m_mesh_cache_enabled;
+
+    // controls whether domains are converted on a thread pool
+    static bool m_threaded_conversion;
+
     // helpers for specific conversion cases
     static vtkm::cont::DataSet  *UniformBlueprintToVTKmDataSet(const std::string &coords_name,
                                                                const conduit::Node &n_coords,
@@ -57,6 +57,8 @@
 #include <cmath>
 #include <cstring>
 #include <limits>
+#include <map>
+#include <sstream>
 
 #include <flow_workspace.hpp>
 
@@ -932,8 +934,20 @@ global_bounds(const conduit::Node &dataset, const std::string &topo_name)
   }
 #ifdef ASCENT_MPI_ENABLED
   MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
-  MPI_Allreduce(MPI_IN_PLACE, min_coords, 3, MPI_DOUBLE, MPI_MIN, mpi_comm);
-  MPI_Allreduce(MPI_IN_PLACE, max_coords, 3, MPI_DOUBLE, MPI_MAX, mpi_comm);
+  // one packed collective instead of two: negate the maxes so both
+  // reductions ride a single MPI_MIN
+  double packed[6];
+  for(int i = 0; i < 3; ++i)
+  {
+    packed[i] = min_coords[i];
+    packed[i + 3] = -max_coords[i];
+  }
+  MPI_Allreduce(MPI_IN_PLACE, packed, 6, MPI_DOUBLE, MPI_MIN, mpi_comm);
+  for(int i = 0; i < 3; ++i)
+  {
+    min_coords[i] = packed[i];
+    max_coords[i] = -packed[i + 3];
+  }
 #endif
   conduit::Node res;
   res["max_coords"].set(max_coords, 3);
@@ -1269,6 +1283,81 @@ void init_bins(double *bins,
 
 }
 
+
+//-----------------------------------------------------------------------------
+// combines a thread's private bins into the shared bins: min/max
+// fold, every other op accumulates
+void combine_bins(double *bins,
+                  const double *local_bins,
+                  const int bins_size,
+                  const std::string &reduction_op)
+{
+  if(reduction_op == "min")
+  {
+    for(int i = 0; i < bins_size; ++i)
+    {
+      bins[i] = std::min(bins[i], local_bins[i]);
+    }
+  }
+  else if(reduction_op == "max")
+  {
+    for(int i = 0; i < bins_size; ++i)
+    {
+      bins[i] = std::max(bins[i], local_bins[i]);
+    }
+  }
+  else
+  {
+    for(int i = 0; i < bins_size; ++i)
+    {
+      bins[i] += local_bins[i];
+    }
+  }
+}
+
+//-----------------------------------------------------------------------------
+// bins values with per-thread private bins merged once per thread,
+// since update_bin cannot run concurrently on shared bins
+template<typename ValueFn>
+void bin_values(double *bins,
+                const int bins_size,
+                const int *homes,
+                const int homes_size,
+                const std::string &reduction_op,
+                ValueFn value_fn)
+{
+#ifdef ASCENT_USE_OPENMP
+  #pragma omp parallel
+  {
+    double *local_bins = new double[bins_size]();
+    init_bins(local_bins, bins_size, reduction_op);
+
+    #pragma omp for nowait
+    for(int i = 0; i < homes_size; ++i)
+    {
+      if(homes[i] != -1)
+      {
+        update_bin(local_bins, homes[i], value_fn(i), reduction_op);
+      }
+    }
+
+    #pragma omp critical(binning_combine)
+    {
+      combine_bins(bins, local_bins, bins_size, reduction_op);
+    }
+    delete[] local_bins;
+  }
+#else
+  for(int i = 0; i < homes_size; ++i)
+  {
+    if(homes[i] != -1)
+    {
+      update_bin(bins, homes[i], value_fn(i), reduction_op);
+    }
+  }
+#endif
+}
+
 // reduction_op: sum, min, max, avg, pdf, std, var, rms
 conduit::Node
 binning(const conduit::Node &dataset,
@@ -1362,12 +1451,48 @@ binning(const conduit::Node &dataset,
   double *bins = new double[bins_size]();
   init_bins(bins, bins_size, reduction_op);
 
+  // bin assignment depends only on the axes, topology, and
+  // association - never on the reduction variable - so query lists
+  // that bin many variables over the same spatial axes reuse the
+  // per-domain assignment instead of rebuilding it per call. The
+  // cache holds the current cycle only; a new cycle clears it.
+  static std::map<std::string, conduit::Node> homes_cache;
+  static int homes_cache_cycle = -1;
+
+  int bin_cycle = -1;
+  if(dataset.number_of_children() > 0 &&
+     dataset.child(0).has_path("state/cycle"))
+  {
+    bin_cycle = dataset.child(0)["state/cycle"].to_int32();
+  }
+  if(bin_cycle != homes_cache_cycle)
+  {
+    homes_cache.clear();
+    homes_cache_cycle = bin_cycle;
+  }
+
   for(int dom_index = 0; dom_index < dataset.number_of_children(); ++dom_index)
   {
     const conduit::Node &dom = dataset.child(dom_index);
 
-    conduit::Node n_homes;
-    populate_homes(dom, bin_axes, topo_name, assoc_str, n_homes);
+    std::ostringstream homes_key_oss;
+    // the dataset identity is part of the key: binnings over the
+    // published source and over a pipeline-reduced dataset can run
+    // in the same cycle (through the extract expression hooks), and
+    // sharing an assignment between them would index value arrays of
+    // a different size. The stamp includes structural counts, not
+    // just the address - a freed dataset reallocated at the same
+    // address must not inherit the old assignment
+    homes_key_oss << dataset_stamp(dataset) << "|"
+                  << dom_index << "|" << topo_name << "|" << assoc_str
+                  << "|" << bin_axes.to_json();
+    const std::string homes_key = homes_key_oss.str();
+
+    conduit::Node &n_homes = homes_cache[homes_key];
+    if(n_homes.dtype().is_empty() && !n_homes.has_child("error"))
+    {
+      populate_homes(dom, bin_axes, topo_name, assoc_str, n_homes);
+    }
 
     if(n_homes.has_path("error"))
     {
@@ -1383,16 +1508,8 @@ binning(const conduit::Node &dataset,
     // update bins
     if(reduction_var.empty())
     {
-//#ifdef ASCENT_USE_OPENMP
-//#pragma omp parallel for
-//#endif
-      for(int i = 0; i < homes_size; ++i)
-      {
-        if(homes[i] != -1)
-        {
-          update_bin(bins, homes[i], 1, reduction_op);
-        }
-      }
+      bin_values(bins, bins_size, homes, homes_size, reduction_op,
+                 [](int){ return 1.0; });
     }
     else if(dom.has_path("fields/" + reduction_var))
     {
@@ -1403,30 +1520,14 @@ binning(const conduit::Node &dataset,
       if(dom[values_path].dtype().is_float32())
       {
         const conduit::float32_array values = dom[values_path].value();
-//#ifdef ASCENT_USE_OPENMP
-//#pragma omp parallel for
-//#endif
-        for(int i = 0; i < homes_size; ++i)
-        {
-          if(homes[i] != -1)
-          {
-            update_bin(bins, homes[i], values[i], reduction_op);
-          }
-        }
+        bin_values(bins, bins_size, homes, homes_size, reduction_op,
+                   [&values](int i){ return (double)values[i]; });
       }
       else
       {
         const conduit::float64_array values = dom[values_path].value();
-//#ifdef ASCENT_USE_OPENMP
-//#pragma omp parallel for
-//#endif
-        for(int i = 0; i < homes_size; ++i)
-        {
-          if(homes[i] != -1)
-          {
-            update_bin(bins, homes[i], values[i], reduction_op);
-          }
-        }
+        bin_values(bins, bins_size, homes, homes_size, reduction_op,
+                   [&values](int i){ return (double)values[i]; });
       }
     }
     else if(is_xyz(reduction_var))
@@ -1974,6 +2075,87 @@ field_inf_count(const conduit::Node &dataset, const std::string &field)
   return res;
 }
 
+// note on spatial query acceleration: point/axis expression queries
+// (max_from_point, point_and_axis) scan elements per call because no
+// spatial index exists at this layer to consult - the BVHs built by
+// rendering live inside vtk-m filter internals (see the collection's
+// cache notes). When a queryable index lands, the other half of the
+// request applies here: resolve all of a cycle's probe points in one
+// traversal instead of per-expression scans. The per-cycle memo
+// already dedups identical probes.
+
+std::string dataset_stamp(const conduit::Node &dataset)
+{
+  std::ostringstream oss;
+  oss << (const void*)&dataset << "_" << dataset.number_of_children();
+  if(dataset.number_of_children() > 0)
+  {
+    const conduit::Node &dom = dataset.child(0);
+    if(dom.has_child("fields") &&
+       dom["fields"].number_of_children() > 0)
+    {
+      const conduit::Node &f0 = dom["fields"].child(0);
+      oss << "_" << dom["fields"].number_of_children();
+      if(f0.has_child("values") &&
+         f0["values"].number_of_children() == 0)
+      {
+        oss << "_" << f0["values"].dtype().number_of_elements()
+            << "_" << f0["values"].data_ptr();
+      }
+    }
+  }
+  return oss.str();
+}
+
+static bool g_deterministic_reductions = false;
+
+void set_deterministic_reductions(bool enabled)
+{
+  g_deterministic_reductions = enabled;
+  // rank-local sums must pin their order too, or the gathered
+  // partials are already unstable before the fixed-order combine
+  set_deterministic_sums(enabled);
+}
+
+bool deterministic_reductions()
+{
+  return g_deterministic_reductions;
+}
+
+conduit::Node
+field_range(const conduit::Node &dataset, const std::string &field_name)
+{
+  double min_value = std::numeric_limits<double>::max();
+  double max_value = std::numeric_limits<double>::lowest();
+
+  for(int i = 0; i < dataset.number_of_children(); ++i)
+  {
+    const conduit::Node &dom = dataset.child(i);
+    if(dom.has_path("fields/" + field_name))
+    {
+      const std::string path = "fields/" + field_name + "/values";
+      conduit::Node min_res = array_min(dom[path]);
+      conduit::Node max_res = array_max(dom[path]);
+      min_value = std::min(min_value, min_res["value"].to_float64());
+      max_value = std::max(max_value, max_res["value"].to_float64());
+    }
+  }
+
+#ifdef ASCENT_MPI_ENABLED
+  MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
+  // min and negated max ride one MPI_MIN
+  double packed[2] = {min_value, -max_value};
+  MPI_Allreduce(MPI_IN_PLACE, packed, 2, MPI_DOUBLE, MPI_MIN, mpi_comm);
+  min_value = packed[0];
+  max_value = -packed[1];
+#endif
+
+  conduit::Node res;
+  res["min_value"] = min_value;
+  res["max_value"] = max_value;
+  return res;
+}
+
 conduit::Node
 field_min(const conduit::Node &dataset, const std::string &field)
 {
@@ -2037,9 +2219,16 @@ field_min(const conduit::Node &dataset, const std::string &field)
   min_value = minloc.value;
 
   double *ploc = loc.as_float64_ptr();
-  MPI_Bcast(ploc, 3, MPI_DOUBLE, minloc_res.rank, mpi_comm);
-  MPI_Bcast(&domain_id, 1, MPI_INT, minloc_res.rank, mpi_comm);
-  MPI_Bcast(&index, 1, MPI_INT, minloc_res.rank, mpi_comm);
+  // pack position, domain, and index into one broadcast; integers
+  // round trip exactly through doubles at these magnitudes
+  double packed[5] = {ploc[0], ploc[1], ploc[2],
+                      (double)domain_id, (double)index};
+  MPI_Bcast(packed, 5, MPI_DOUBLE, minloc_res.rank, mpi_comm);
+  ploc[0] = packed[0];
+  ploc[1] = packed[1];
+  ploc[2] = packed[2];
+  domain_id = (int)packed[3];
+  index = (int)packed[4];
 
   loc.set(ploc, 3);
 
@@ -2083,14 +2272,58 @@ field_sum(const conduit::Node &dataset, const std::string &field)
   int rank;
   MPI_Comm mpi_comm = MPI_Comm_f2c(flow::Workspace::default_mpi_comm());
   MPI_Comm_rank(mpi_comm, &rank);
-  double global_sum;
-  MPI_Allreduce(&sum, &global_sum, 1, MPI_DOUBLE, MPI_SUM, mpi_comm);
+  if(g_deterministic_reductions)
+  {
+    // bitwise-stable mode: gather the rank partials and combine them
+    // in fixed rank order with compensated addition on rank zero,
+    // then broadcast. Slower than the allreduce, but identical
+    // results for any rank count or reduction tree.
+    int comm_size = 1;
+    MPI_Comm_size(mpi_comm, &comm_size);
+
+    double packed[2] = {sum, (double)count};
+    std::vector<double> all(2 * comm_size, 0.0);
+    MPI_Gather(packed, 2, MPI_DOUBLE,
+               &all[0], 2, MPI_DOUBLE, 0, mpi_comm);
+
+    if(rank == 0)
+    {
+      double d_sum = 0.0;
+      double d_corr = 0.0;
+      double d_count = 0.0;
+      for(int r = 0; r < comm_size; ++r)
+      {
+        const double val = all[2 * r];
+        const double t = d_sum + val;
+        if(std::abs(d_sum) >= std::abs(val))
+        {
+          d_corr += (d_sum - t) + val;
+        }
+        else
+        {
+          d_corr += (val - t) + d_sum;
+        }
+        d_sum = t;
+        d_count += all[2 * r + 1];
+      }
+      packed[0] = d_sum + d_corr;
+      packed[1] = d_count;
+    }
 
-  long long int global_count;
-  MPI_Allreduce(&count, &global_count, 1, MPI_LONG_LONG_INT, MPI_SUM, mpi_comm);
+    MPI_Bcast(packed, 2, MPI_DOUBLE, 0, mpi_comm);
+    sum = packed[0];
+    count = (long long int)packed[1];
+  }
+  else
+  {
+    // sum and count ride one collective; counts stay exact in a
+    // double well past any zone count we will see
+    double packed[2] = {sum, (double)count};
+    MPI_Allreduce(MPI_IN_PLACE, packed, 2, MPI_DOUBLE, MPI_SUM, mpi_comm);
 
-  sum = global_sum;
-  count = global_count;
+    sum = packed[0];
+    count = (long long int)packed[1];
+  }
 #endif
 
   conduit::Node res;
@@ -2174,9 +2407,16 @@ field_max(const conduit::Node &dataset, const std::string &field)
   max_value = maxloc.value;
 
   double *ploc = loc.as_float64_ptr();
-  MPI_Bcast(ploc, 3, MPI_DOUBLE, maxloc_res.rank, mpi_comm);
-  MPI_Bcast(&domain_id, 1, MPI_INT, maxloc_res.rank, mpi_comm);
-  MPI_Bcast(&index, 1, MPI_INT, maxloc_res.rank, mpi_comm);
+  // pack position, domain, and index into one broadcast; integers
+  // round trip exactly through doubles at these magnitudes
+  double packed[5] = {ploc[0], ploc[1], ploc[2],
+                      (double)domain_id, (double)index};
+  MPI_Bcast(packed, 5, MPI_DOUBLE, maxloc_res.rank, mpi_comm);
+  ploc[0] = packed[0];
+  ploc[1] = packed[1];
+  ploc[2] = packed[2];
+  domain_id = (int)packed[3];
+  index = (int)packed[4];
 
   loc.set(ploc, 3);
   rank = maxloc_res.rank;
@@ -2331,7 +2571,11 @@ void paint_nestsets(const std::string nestset_name,
     }
     if(is_3d)
     {
-      // all the nesting relationship is local
+      // all the nesting relationship is local; planes of one window
+      // never overlap so they can paint concurrently
+#ifdef ASCENT_USE_OPENMP
+      #pragma omp parallel for
+#endif
       for(int z = origin[2]; z < origin[2] + dims[2]; ++z)
       {
         const int z_offset = z * el_dims[0] * el_dims[1];
@@ -2354,6 +2598,9 @@ void paint_nestsets(const std::string nestset_name,
     else
     {
       // all the nesting relationship is local
+#ifdef ASCENT_USE_OPENMP
+      #pragma omp parallel for
+#endif
       for(int y = origin[1]; y < origin[1] + dims[1]; ++y)
       {
         const conduit::int32 y_offset = y * el_dims[0];
@@ -85,6 +85,28 @@ conduit::Node element_location(const conduit::Node &domain,
 conduit::Node field_max(const conduit::Node &dataset,
                         const std::string &field_name);
 
+// cheap identity stamp for a dataset used as a cache key component:
+// an address alone can be recycled by the allocator within a cycle,
+// so the stamp folds in structural counts (domains, fields, first
+// field's element count and buffer address) that distinguish the
+// published source from pipeline-reduced subsets landing at a
+// reused address
+std::string ASCENT_API dataset_stamp(const conduit::Node &dataset);
+
+// deterministic reduction mode: when enabled, order-sensitive MPI
+// reductions (sums) run as a gather plus a fixed rank-order
+// compensated sum on rank zero, so results are bitwise stable across
+// runs and rank counts. Off by default (the packed allreduce is the
+// fast path). min/max reductions are order-insensitive and unchanged.
+void ASCENT_API set_deterministic_reductions(bool enabled);
+bool ASCENT_API deterministic_reductions();
+
+// min and max values only (no positions): one pass over the field
+// and one packed collective, for consumers like histogram that
+// otherwise run field_min and field_max back to back
+conduit::Node field_range(const conduit::Node &dataset,
+                          const std::string &field_name);
+
 conduit::Node field_min(const conduit::Node &dataset,
                         const std::string &field_name);
 
@@ -75,8 +75,31 @@ namespace runtime
 namespace expressions
 {
 
+// order-sensitive kernels consult this to pin their accumulation
+// order; see set_deterministic_sums
+static bool g_deterministic_sums = false;
+
+void set_deterministic_sums(bool enabled)
+{
+  g_deterministic_sums = enabled;
+}
+
+bool deterministic_sums()
+{
+  return g_deterministic_sums;
+}
+
 namespace detail
 {
+// note on sampled (error-bounded) reductions: the kernels below are
+// the right place for strided/stratified variants, but the public
+// contract lives in the expression function table - every reduction
+// signature needs an optional rel_error argument, and the confidence
+// bound needs the sample variance, which means the sampled kernels
+// return (estimate, variance, n) rather than bare values. The memo
+// layer already collapses repeated exact evaluations within a cycle,
+// which is where most of the trigger-set cost went; sampling is the
+// follow-on for single-shot evaluation cost.
 
 template<typename Function>
 conduit::Node
@@ -104,6 +127,16 @@ type_dispatch(const conduit::Node &values, const Function &func)
     const conduit::int64 *ptr =  values.as_int64_ptr();
     res = func(ptr, num_vals);
   }
+  else if(values.dtype().is_uint32())
+  {
+    const conduit::uint32 *ptr =  values.as_uint32_ptr();
+    res = func(ptr, num_vals);
+  }
+  else if(values.dtype().is_uint64())
+  {
+    const conduit::uint64 *ptr =  values.as_uint64_ptr();
+    res = func(ptr, num_vals);
+  }
   else
   {
     ASCENT_ERROR("Type dispatch: unsupported array type");
@@ -196,17 +229,58 @@ struct SumFunctor
   template<typename T>
   conduit::Node operator()(const T* values, const int &size) const
   {
-    T sum = 0;
+    // accumulate in double with Neumaier compensation: each thread
+    // carries a (sum, correction) pair and the partials combine by
+    // plain addition, so float32 sums stay stable at the element
+    // counts queries see and integer input no longer overflows the
+    // element type
+    double sum  = 0.;
+    double corr = 0.;
+
+    if(g_deterministic_sums)
+    {
+      // bitwise-stable mode: OpenMP's partial-combine order is
+      // unspecified, so the local accumulation runs serially in
+      // index order; the architect's fixed-order MPI combine
+      // handles the cross-rank half
+      for(int v = 0; v < size; ++v)
+      {
+        const double val = static_cast<double>(values[v]);
+        const double t = sum + val;
+        if(std::fabs(sum) >= std::fabs(val))
+        {
+          corr += (sum - t) + val;
+        }
+        else
+        {
+          corr += (val - t) + sum;
+        }
+        sum = t;
+      }
+    }
+    else
+    {
 #ifdef ASCENT_USE_OPENMP
-    #pragma omp parallel for reduction(+:sum)
+    #pragma omp parallel for reduction(+:sum,corr)
 #endif
     for(int v = 0; v < size; ++v)
     {
-      double val = static_cast<double>(values[v]);
-      sum += val;
+      const double val = static_cast<double>(values[v]);
+      const double t = sum + val;
+      if(std::fabs(sum) >= std::fabs(val))
+      {
+        corr += (sum - t) + val;
+      }
+      else
+      {
+        corr += (val - t) + sum;
+      }
+      sum = t;
+    }
     }
+
     conduit::Node res;
-    res["value"] = sum;
+    res["value"] = sum + corr;
     res["count"] = (int)size;
     return res;
   }
@@ -217,19 +291,19 @@ struct NanFunctor
   template<typename T>
   conduit::Node operator()(const T* values, const int &size) const
   {
-    T sum = 0;
+    // count in a wide integer: accumulating in T both truncates for
+    // small integer types and costs precision for float inputs
+    conduit::int64 sum = 0;
 #ifdef ASCENT_USE_OPENMP
     #pragma omp parallel for reduction(+:sum)
 #endif
     for(int v = 0; v < size; ++v)
     {
-      T is_nan = T(0);
       const T value = values[v];
       if(value != value)
       {
-        is_nan = T(1);
+        sum += 1;
       }
-      sum += is_nan;
     }
 
     conduit::Node res;
@@ -307,8 +381,34 @@ struct HistogramFunctor
     double *bins = new double[m_num_bins];
     memset(bins, 0, sizeof(double) * m_num_bins);
 #ifdef ASCENT_USE_OPENMP
-    #pragma omp parallel for
-#endif
+    // per thread bins merged once at the end: an atomic per element
+    // serializes the whole loop on contended bins
+    #pragma omp parallel
+    {
+      double *local_bins = new double[m_num_bins];
+      memset(local_bins, 0, sizeof(double) * m_num_bins);
+
+      #pragma omp for nowait
+      for(int v = 0; v < size; ++v)
+      {
+        double val = static_cast<double>(values[v]);
+        int bin_index = static_cast<int>((val - m_min_val) * inv_delta);
+        // clamp for now
+        // another option is not to count data outside the range
+        bin_index = std::max(0, std::min(bin_index, m_num_bins - 1));
+        local_bins[bin_index]++;
+      }
+
+      #pragma omp critical
+      {
+        for(int b = 0; b < m_num_bins; ++b)
+        {
+          bins[b] += local_bins[b];
+        }
+      }
+      delete[] local_bins;
+    }
+#else
     for(int v = 0; v < size; ++v)
     {
       double val = static_cast<double>(values[v]);
@@ -316,12 +416,9 @@ struct HistogramFunctor
       // clamp for now
       // another option is not to count data outside the range
       bin_index = std::max(0, std::min(bin_index, m_num_bins - 1));
-#ifdef ASCENT_USE_OPENMP
-      #pragma omp atomic
-#endif
       bins[bin_index]++;
-
     }
+#endif
     conduit::Node res;
     res["value"].set(bins, m_num_bins);
     res["bin_size"] = (m_max_val - m_min_val) / double(m_num_bins);
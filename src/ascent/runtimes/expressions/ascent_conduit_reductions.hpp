@@ -74,6 +74,14 @@ namespace runtime
 namespace expressions
 {
 
+// when enabled, order-sensitive local reductions (sums) run a
+// serial compensated loop instead of the OpenMP reduction, whose
+// partial-combine order is unspecified; paired with the fixed-order
+// MPI combine in the blueprint architect this makes sums bitwise
+// stable across runs and rank counts
+void set_deterministic_sums(bool enabled);
+bool deterministic_sums();
+
 conduit::Node array_max(const conduit::Node &values);
 
 conduit::Node array_min(const conduit::Node &values);
@@ -284,8 +284,246 @@ logic_op(const bool lhs, const bool rhs, const std::string &op)
   return res;
 }
 
+//-----------------------------------------------------------------------------
+// the element wise kernel behind field arithmetic; templated so
+// float32 inputs run a pure float32 pass instead of being promoted
+// to double arrays (publishing codes are float32 end to end and the
+// bandwidth matters more than the precision)
+template<typename T>
+void
+field_op_apply(const T *l_ptr,
+               const T *r_ptr,
+               const T l_scalar,
+               const T r_scalar,
+               const bool l_is_field,
+               const bool r_is_field,
+               T *out,
+               const int size,
+               const std::string &op_str)
+{
+  if(op_str == "+")
+  {
+#ifdef ASCENT_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for(int i = 0; i < size; ++i)
+    {
+      const T l = l_is_field ? l_ptr[i] : l_scalar;
+      const T r = r_is_field ? r_ptr[i] : r_scalar;
+      out[i] = l + r;
+    }
+  }
+  else if(op_str == "-")
+  {
+#ifdef ASCENT_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for(int i = 0; i < size; ++i)
+    {
+      const T l = l_is_field ? l_ptr[i] : l_scalar;
+      const T r = r_is_field ? r_ptr[i] : r_scalar;
+      out[i] = l - r;
+    }
+  }
+  else if(op_str == "*")
+  {
+#ifdef ASCENT_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for(int i = 0; i < size; ++i)
+    {
+      const T l = l_is_field ? l_ptr[i] : l_scalar;
+      const T r = r_is_field ? r_ptr[i] : r_scalar;
+      out[i] = l * r;
+    }
+  }
+  else if(op_str == "/")
+  {
+#ifdef ASCENT_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for(int i = 0; i < size; ++i)
+    {
+      const T l = l_is_field ? l_ptr[i] : l_scalar;
+      const T r = r_is_field ? r_ptr[i] : r_scalar;
+      out[i] = l / r;
+    }
+  }
+  else
+  {
+    ASCENT_ERROR("field arithmetic: unsupported op '"<<op_str<<"'");
+  }
+}
+
+//-----------------------------------------------------------------------------
+// field arithmetic: evaluates 'lhs op rhs' element wise across every
+// domain, where at least one side is a field, in a single fused,
+// OpenMP parallel pass per operation. The result is registered on the
+// dataset as a derived field with a reserved name so every downstream
+// field function (field_max, histograms, ...) can consume it; the
+// temporaries are stripped after the expression finishes.
+std::string
+field_binary_op(conduit::Node &dataset,
+                const conduit::Node &n_lhs,
+                const conduit::Node &n_rhs,
+                const std::string &op_str)
+{
+  const std::string l_type = n_lhs["type"].as_string();
+  const std::string r_type = n_rhs["type"].as_string();
+
+  const bool l_is_field = l_type == "field";
+  const bool r_is_field = r_type == "field";
+
+  if((!l_is_field && !is_scalar(l_type)) ||
+     (!r_is_field && !is_scalar(r_type)))
+  {
+    ASCENT_ERROR("field arithmetic supports 'field op field' and "
+                 "'field op scalar', got types '"<<l_type<<"' and '"
+                 <<r_type<<"'");
+  }
+
+  if(op_str == "%")
+  {
+    ASCENT_ERROR("field arithmetic does not support '%'");
+  }
+
+  std::string l_field = l_is_field ? n_lhs["value"].as_string() : "";
+  std::string r_field = r_is_field ? n_rhs["value"].as_string() : "";
+
+  double l_scalar = l_is_field ? 0.0 : n_lhs["value"].to_float64();
+  double r_scalar = r_is_field ? 0.0 : n_rhs["value"].to_float64();
+
+  // reserved, unique name for the derived result
+  static int derived_counter = 0;
+  std::stringstream res_ss;
+  res_ss << "ascent_derived_" << derived_counter++;
+  const std::string res_name = res_ss.str();
+
+  const int num_domains = dataset.number_of_children();
+  for(int d = 0; d < num_domains; ++d)
+  {
+    conduit::Node &dom = dataset.child(d);
+
+    const std::string ref_field = l_is_field ? l_field : r_field;
+    if(!dom.has_path("fields/" + ref_field))
+    {
+      continue;
+    }
+    const conduit::Node &ref = dom["fields/" + ref_field];
+    const int size = ref["values"].dtype().number_of_elements();
+
+    // float32 inputs run the float32 kernel and produce a float32
+    // derived field; anything else is pulled up to float64, with
+    // conversions only for exotic layouts
+    const conduit::Node *l_node =
+        l_is_field ? &dom["fields/" + l_field + "/values"] : nullptr;
+    const conduit::Node *r_node =
+        r_is_field ? &dom["fields/" + r_field + "/values"] : nullptr;
+
+    if(r_node != nullptr &&
+       r_node->dtype().number_of_elements() != size)
+    {
+      ASCENT_ERROR("field arithmetic: fields '"<<l_field<<"' and '"
+                   <<r_field<<"' have different sizes");
+    }
+
+    const bool l_f32 = l_node == nullptr ||
+                       (l_node->dtype().is_float32() && l_node->is_compact());
+    const bool r_f32 = r_node == nullptr ||
+                       (r_node->dtype().is_float32() && r_node->is_compact());
+
+    conduit::Node &res_field = dom["fields/" + res_name];
+    res_field["association"] = ref["association"];
+    res_field["topology"] = ref["topology"];
+
+    if(l_f32 && r_f32 && (l_node != nullptr || r_node != nullptr))
+    {
+      res_field["values"].set(conduit::DataType::float32(size));
+      conduit::float32 *out = res_field["values"].value();
+
+      field_op_apply<conduit::float32>(
+          l_node != nullptr ? l_node->as_float32_ptr() : NULL,
+          r_node != nullptr ? r_node->as_float32_ptr() : NULL,
+          (conduit::float32)l_scalar,
+          (conduit::float32)r_scalar,
+          l_is_field,
+          r_is_field,
+          out,
+          size,
+          op_str);
+    }
+    else
+    {
+      conduit::Node l_vals, r_vals;
+      if(l_node != nullptr)
+      {
+        if(l_node->dtype().is_float64() && l_node->is_compact())
+        {
+          l_vals.set_external(const_cast<conduit::Node&>(*l_node));
+        }
+        else
+        {
+          l_node->to_float64_array(l_vals);
+        }
+      }
+      if(r_node != nullptr)
+      {
+        if(r_node->dtype().is_float64() && r_node->is_compact())
+        {
+          r_vals.set_external(const_cast<conduit::Node&>(*r_node));
+        }
+        else
+        {
+          r_node->to_float64_array(r_vals);
+        }
+      }
+
+      res_field["values"].set(conduit::DataType::float64(size));
+      conduit::float64 *out = res_field["values"].value();
+
+      field_op_apply<conduit::float64>(
+          l_node != nullptr ? l_vals.as_float64_ptr() : NULL,
+          r_node != nullptr ? r_vals.as_float64_ptr() : NULL,
+          l_scalar,
+          r_scalar,
+          l_is_field,
+          r_is_field,
+          out,
+          size,
+          op_str);
+    }
+  }
+
+  return res_name;
+}
+
 } // namespace detail
 
+//-----------------------------------------------------------------------------
+// see header: removes derived field temporaries after evaluation
+void
+strip_derived_fields(conduit::Node &dataset)
+{
+  const int num_domains = dataset.number_of_children();
+  for(int d = 0; d < num_domains; ++d)
+  {
+    conduit::Node &dom = dataset.child(d);
+    if(!dom.has_child("fields"))
+    {
+      continue;
+    }
+    conduit::Node &fields = dom["fields"];
+    const std::vector<std::string> names = fields.child_names();
+    for(size_t f = 0; f < names.size(); ++f)
+    {
+      if(names[f].compare(0, 15, "ascent_derived_") == 0)
+      {
+        fields.remove(names[f]);
+      }
+    }
+  }
+}
+
 //-----------------------------------------------------------------------------
 NullArg::NullArg() : Filter()
 {
@@ -320,7 +558,7 @@ NullArg::verify_params(const conduit::Node &params, conduit::Node &info)
 void
 NullArg::execute()
 {
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   set_output<conduit::Node>(output);
 }
 
@@ -363,7 +601,7 @@ Identifier::verify_params(const conduit::Node &params, conduit::Node &info)
 void
 Identifier::execute()
 {
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   std::string i_name = params()["value"].as_string();
 
   const conduit::Node *const cache =
@@ -425,7 +663,7 @@ Boolean::verify_params(const conduit::Node &params, conduit::Node &info)
 void
 Boolean::execute()
 {
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   (*output)["value"] = params()["value"].to_uint8();
   (*output)["type"] = "bool";
   set_output<conduit::Node>(output);
@@ -472,7 +710,7 @@ Integer::verify_params(const conduit::Node &params, conduit::Node &info)
 void
 Integer::execute()
 {
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   (*output)["value"] = params()["value"].to_int32();
   (*output)["type"] = "int";
   set_output<conduit::Node>(output);
@@ -517,7 +755,7 @@ Double::verify_params(const conduit::Node &params, conduit::Node &info)
 void
 Double::execute()
 {
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   (*output)["value"] = params()["value"].to_float64();
   (*output)["type"] = "double";
   set_output<conduit::Node>(output);
@@ -562,7 +800,7 @@ String::verify_params(const conduit::Node &params, conduit::Node &info)
 void
 String::execute()
 {
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
 
   (*output)["value"] = params()["value"].as_string();
   (*output)["type"] = "string";
@@ -619,12 +857,24 @@ BinaryOp::execute()
   const std::string l_type = (*n_lhs)["type"].as_string();
   const std::string r_type = (*n_rhs)["type"].as_string();
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   std::stringstream msg;
 
   if(detail::is_math(op_str))
   {
-    if(detail::is_scalar(l_type) && detail::is_scalar(r_type))
+    if(l_type == "field" || r_type == "field")
+    {
+      // field arithmetic runs as one fused pass over every domain
+      // and hands back a derived field the rest of the expression
+      // (reductions, histograms, nested arithmetic) consumes by name
+      conduit::Node *dataset =
+          graph().workspace().registry().fetch<Node>("dataset");
+      std::string res_name =
+          detail::field_binary_op(*dataset, *n_lhs, *n_rhs, op_str);
+      (*output)["value"] = res_name;
+      (*output)["type"] = "field";
+    }
+    else if(detail::is_scalar(l_type) && detail::is_scalar(r_type))
     {
       // promote to double if at least one is a double
       if(l_type == "double" || r_type == "double")
@@ -770,7 +1020,7 @@ ArrayAccess::execute()
   const conduit::Node *n_array = input<Node>("array");
   const conduit::Node *n_index = input<Node>("index");
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
 
   int index = (*n_index)["value"].as_int32();
   int length = (*n_array)["value"].dtype().number_of_elements();
@@ -828,7 +1078,7 @@ DotAccess::execute()
   conduit::Node *n_obj = input<Node>("obj");
   std::string name = params()["name"].as_string();
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
 
   // fills attrs for basic types like vectors
   detail::fill_attrs(*n_obj);
@@ -904,7 +1154,7 @@ ExpressionList::verify_params(const conduit::Node &params, conduit::Node &info)
 void
 ExpressionList::execute()
 {
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
 
   for(int item_num = 0; item_num < 256; ++item_num)
   {
@@ -955,7 +1205,7 @@ ArrayMin::verify_params(const conduit::Node &params, conduit::Node &info)
 void
 ArrayMin::execute()
 {
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   (*output)["value"] = array_min((*input<Node>("arg1"))["value"]);
   (*output)["type"] = "double";
 
@@ -1000,7 +1250,7 @@ ScalarMin::execute()
   const conduit::Node *arg1 = input<Node>("arg1");
   const conduit::Node *arg2 = input<Node>("arg2");
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
 
   if((*arg1)["type"].as_string() == "double" ||
      (*arg2)["type"].as_string() == "double")
@@ -1060,7 +1310,7 @@ ScalarMax::execute()
   const conduit::Node *arg1 = input<Node>("arg1");
   const conduit::Node *arg2 = input<Node>("arg2");
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
 
   if((*arg1)["type"].as_string() == "double" ||
      (*arg2)["type"].as_string() == "double")
@@ -1119,7 +1369,7 @@ FieldMin::execute()
 
   const std::string field = (*arg1)["value"].as_string();
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
 
   const conduit::Node *const dataset =
       graph().workspace().registry().fetch<Node>("dataset");
@@ -1179,7 +1429,7 @@ ArrayMax::verify_params(const conduit::Node &params, conduit::Node &info)
 void
 ArrayMax::execute()
 {
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   (*output)["value"] = array_max((*input<Node>("arg1"))["value"]);
   (*output)["type"] = "double";
 
@@ -1225,7 +1475,7 @@ FieldMax::execute()
 
   const std::string field = (*arg1)["value"].as_string();
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
 
   const conduit::Node *const dataset =
       graph().workspace().registry().fetch<Node>("dataset");
@@ -1285,7 +1535,7 @@ ArrayAvg::verify_params(const conduit::Node &params, conduit::Node &info)
 void
 ArrayAvg::execute()
 {
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   conduit::Node sum = array_sum((*input<Node>("arg1"))["value"]);
   (*output)["value"] = sum["value"].to_float64() / sum["count"].to_float64();
   (*output)["type"] = "double";
@@ -1331,7 +1581,7 @@ FieldAvg::execute()
 
   const std::string field = (*arg1)["value"].as_string();
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
 
   const conduit::Node *const dataset =
       graph().workspace().registry().fetch<Node>("dataset");
@@ -1383,7 +1633,7 @@ Cycle::verify_params(const conduit::Node &params, conduit::Node &info)
 void
 Cycle::execute()
 {
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
 
   const conduit::Node *const dataset =
       graph().workspace().registry().fetch<Node>("dataset");
@@ -1419,6 +1669,7 @@ History::declare_interface(Node &i)
   i["port_names"].append() = "expr_name";
   i["port_names"].append() = "absolute_index";
   i["port_names"].append() = "relative_index";
+  i["port_names"].append() = "window";
   i["output_port"] = "true";
 }
 
@@ -1435,7 +1686,7 @@ History::verify_params(const conduit::Node &params, conduit::Node &info)
 void
 History::execute()
 {
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
 
   const std::string expr_name  = (*input<Node>("expr_name"))["name"].as_string();
 
@@ -1450,17 +1701,52 @@ History::execute()
 
   const conduit::Node *n_absolute_index = input<Node>("absolute_index");
   const conduit::Node *n_relative_index = input<Node>("relative_index");
+  const conduit::Node *n_window = input<Node>("window");
 
-
-  if(!n_absolute_index->dtype().is_empty() &&
-     !n_relative_index->dtype().is_empty())
+  int index_args = 0;
+  if(!n_absolute_index->dtype().is_empty()) index_args++;
+  if(!n_relative_index->dtype().is_empty()) index_args++;
+  if(!n_window->dtype().is_empty()) index_args++;
+  if(index_args > 1)
   {
-    ASCENT_ERROR(
-        "History: Specify only one of relative_index or absolute_index.");
+    ASCENT_ERROR("History: Specify only one of relative_index, "
+                 "absolute_index, or window.");
   }
 
-
   const int entries = history.number_of_children();
+
+  if(!n_window->dtype().is_empty())
+  {
+    // windowed mode: the last N scalar values packed into one
+    // contiguous array, so moving averages and change detection run
+    // as a single loop (avg(history(p, window=1000))) instead of a
+    // thousand tree probes
+    int window = (*n_window)["value"].to_int32();
+    if(window < 1)
+    {
+      ASCENT_ERROR("History: window must be a positive integer.");
+    }
+    if(window > entries)
+    {
+      window = entries;
+    }
+
+    (*output)["value"].set(conduit::DataType::float64(window));
+    conduit::float64 *vals = (*output)["value"].value();
+    for(int i = 0; i < window; ++i)
+    {
+      const conduit::Node &entry =
+          history.child(entries - window + i);
+      if(!entry.has_child("value"))
+      {
+        ASCENT_ERROR("History: window entries must be scalar results");
+      }
+      vals[i] = entry["value"].to_float64();
+    }
+    (*output)["type"] = "array";
+    set_output<conduit::Node>(output);
+    return;
+  }
   if(!n_relative_index->dtype().is_empty())
   {
     int relative_index = (*n_relative_index)["value"].to_int32();
@@ -1549,7 +1835,7 @@ Vector::execute()
   vec[1] = (*arg2)["value"].to_float64();
   vec[2] = (*arg3)["value"].to_float64();
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   (*output)["type"] = "vector";
   (*output)["value"].set(vec, 3);
   ;
@@ -1595,7 +1881,7 @@ Magnitude::execute()
   double res = 0.;
   const double *vec = (*arg1)["value"].value();
   res = sqrt(vec[0] * vec[0] + vec[1] * vec[1] + vec[2] * vec[2]);
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   (*output)["type"] = "double";
   (*output)["value"] = res;
   set_output<conduit::Node>(output);
@@ -1662,7 +1948,7 @@ Field::execute()
                  << " known = " << ss.str());
   }
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   (*output)["value"] = field;
   (*output)["type"] = "field";
   set_output<conduit::Node>(output);
@@ -1750,7 +2036,7 @@ Axis::execute()
       ASCENT_ERROR("Axis: bins must have at least 2 items.");
     }
 
-    output = new conduit::Node();
+    output = flow::NodePool::instance().acquire();
     (*output)["value/" + name + "/bins"].set(
         conduit::DataType::c_double(bins_len));
     double *bins = (*output)["value/" + name + "/bins"].value();
@@ -1773,7 +2059,7 @@ Axis::execute()
   }
   else
   {
-    output = new conduit::Node();
+    output = flow::NodePool::instance().acquire();
 
     double min_val;
     bool min_found = false;
@@ -1898,22 +2184,33 @@ Histogram::execute()
   double min_val;
   double max_val;
 
-  if(!n_max->dtype().is_empty())
+  if(n_max->dtype().is_empty() && n_min->dtype().is_empty())
   {
-    max_val = (*n_max)["value"].to_float64();
+    // both ends defaulted: one fused range pass (and one collective)
+    // instead of the full min and max location machinery
+    conduit::Node range = field_range(*dataset, field);
+    min_val = range["min_value"].to_float64();
+    max_val = range["max_value"].to_float64();
   }
   else
   {
-    max_val = field_max(*dataset, field)["value"].to_float64();
-  }
+    if(!n_max->dtype().is_empty())
+    {
+      max_val = (*n_max)["value"].to_float64();
+    }
+    else
+    {
+      max_val = field_max(*dataset, field)["value"].to_float64();
+    }
 
-  if(!n_min->dtype().is_empty())
-  {
-    min_val = (*n_min)["value"].to_float64();
-  }
-  else
-  {
-    min_val = field_min(*dataset, field)["value"].to_float64();
+    if(!n_min->dtype().is_empty())
+    {
+      min_val = (*n_min)["value"].to_float64();
+    }
+    else
+    {
+      min_val = field_min(*dataset, field)["value"].to_float64();
+    }
   }
 
   if(min_val >= max_val)
@@ -1923,7 +2220,7 @@ Histogram::execute()
                  << ")");
   }
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   (*output)["type"] = "histogram";
   (*output)["attrs/value/value"] =
       field_histogram(*dataset, field, min_val, max_val, num_bins)["value"];
@@ -2097,7 +2394,7 @@ Binning::execute()
                                            empty_bin_val,
                                            component);
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   (*output)["type"] = "binning";
   (*output)["attrs/value/value"] = n_binning["value"];
   (*output)["attrs/value/type"] = "array";
@@ -2176,7 +2473,7 @@ Entropy::execute()
     ASCENT_ERROR("Entropy: hist must be a histogram");
   }
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   (*output)["value"] = field_entropy(*hist)["value"];
   (*output)["type"] = "double";
   set_output<conduit::Node>(output);
@@ -2218,7 +2515,7 @@ Pdf::execute()
 {
   const conduit::Node *hist = input<conduit::Node>("hist");
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   (*output)["type"] = "histogram";
   (*output)["attrs/value/value"] = field_pdf(*hist)["value"];
   (*output)["attrs/value/type"] = "array";
@@ -2264,7 +2561,7 @@ Cdf::execute()
 {
   const conduit::Node *hist = input<conduit::Node>("hist");
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   (*output)["type"] = "histogram";
   (*output)["attrs/value/value"] = field_cdf(*hist)["value"];
   (*output)["attrs/value/type"] = "array";
@@ -2336,7 +2633,7 @@ Quantile::execute()
     }
   }
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   (*output)["value"] = quantile(*n_cdf, val, interpolation)["value"];
   (*output)["type"] = "double";
   set_output<conduit::Node>(output);
@@ -2389,7 +2686,7 @@ BinByIndex::execute()
                  << num_bins - 1 << "]");
   }
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   const double *bins = (*n_hist)["attrs/value/value"].value();
   (*output)["value"] = bins[bin];
   (*output)["type"] = "double";
@@ -2448,7 +2745,7 @@ BinByValue::execute()
   const double inv_delta = num_bins / (max_val - min_val);
   int bin = static_cast<int>((val - min_val) * inv_delta);
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   const double *bins = (*n_hist)["attrs/value/value"].value();
   (*output)["value"] = bins[bin];
   (*output)["type"] = "double";
@@ -2493,7 +2790,7 @@ FieldSum::execute()
   const conduit::Node *const dataset =
       graph().workspace().registry().fetch<Node>("dataset");
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   (*output)["value"] = field_sum(*dataset, field)["value"];
   (*output)["type"] = "double";
 
@@ -2538,7 +2835,7 @@ FieldNanCount::execute()
   conduit::Node *dataset =
       graph().workspace().registry().fetch<Node>("dataset");
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   (*output)["value"] = field_nan_count(*dataset, field)["value"];
   (*output)["type"] = "double";
 
@@ -2583,7 +2880,7 @@ FieldInfCount::execute()
   conduit::Node *dataset =
       graph().workspace().registry().fetch<Node>("dataset");
 
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   (*output)["value"] = field_inf_count(*dataset, field)["value"];
   (*output)["type"] = "double";
 
@@ -2624,7 +2921,7 @@ ArraySum::verify_params(const conduit::Node &params, conduit::Node &info)
 void
 ArraySum::execute()
 {
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
   (*output)["value"] = array_sum((*input<Node>("arg1"))["value"])["value"];
   (*output)["type"] = "double";
 
@@ -2675,7 +2972,7 @@ PointAndAxis::execute()
   conduit::Node &in_point =  *input<Node>("point");
   conduit::Node &n_miss_val =  *input<Node>("miss_value");
   conduit::Node &n_dir =  *input<Node>("direction");
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
 
   const int num_axes = in_binning["attrs/bin_axes"].number_of_children();
   if(num_axes > 1)
@@ -2802,7 +3099,7 @@ MaxFromPoint::execute()
   conduit::Node &in_binning = *input<Node>("binning");
   conduit::Node &in_axis =  *input<Node>("axis");
   conduit::Node &in_point =  *input<Node>("point");
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
 
   const int num_axes = in_binning["attrs/bin_axes"].number_of_children();
   if(num_axes > 1)
@@ -2908,7 +3205,7 @@ Bin::execute()
 {
   conduit::Node &in_binning = *input<Node>("binning");
   conduit::Node &in_index =  *input<Node>("index");
-  conduit::Node *output = new conduit::Node();
+  conduit::Node *output = flow::NodePool::instance().acquire();
 
   const int num_axes = in_binning["attrs/bin_axes"].number_of_children();
   if(num_axes > 1)
@@ -79,6 +79,10 @@ namespace expressions
 ///
 //-----------------------------------------------------------------------------
 
+/// removes the derived field temporaries ("ascent_derived_*") that
+/// field arithmetic registered on the dataset during evaluation
+void strip_derived_fields(conduit::Node &dataset);
+
 //-----------------------------------------------------------------------------
 class NullArg : public ::flow::Filter
 {
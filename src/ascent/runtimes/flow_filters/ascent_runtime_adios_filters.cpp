@@ -211,6 +211,14 @@ ADIOS::verify_params(const conduit::Node &params,
         res = false;
     }
 
+    if (params.has_child("fields") &&
+        params["fields"].number_of_children() == 0)
+    {
+        info["errors"].append() =
+            "optional entry 'fields' must be a non-empty list";
+        res = false;
+    }
+
     return res;
 }
 
@@ -271,6 +279,17 @@ ADIOS::execute()
 
     if (blueprint_data->has_child("fields"))
     {
+        // optional variable selection: only write the named fields
+        std::set<std::string> selected;
+        if(params().has_path("fields"))
+        {
+            NodeConstIterator sel_itr = params()["fields"].children();
+            while(sel_itr.has_next())
+            {
+                selected.insert(sel_itr.next().as_string());
+            }
+        }
+
         const Node &fields = (*blueprint_data)["fields"];
         NodeConstIterator fields_itr = fields.children();
 
@@ -278,6 +297,11 @@ ADIOS::execute()
         {
             const Node& field = fields_itr.next();
             std::string field_name = fields_itr.name();
+            if(!selected.empty() &&
+               selected.find(field_name) == selected.end())
+            {
+                continue;
+            }
             FieldVariable(field_name, field);
         }
     }
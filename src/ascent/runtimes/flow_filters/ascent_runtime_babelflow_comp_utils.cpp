@@ -10,6 +10,7 @@
 #include <fstream>
 
 #include <ascent_png_encoder.hpp>
+#include <ascent_png_write_service.hpp>
 #include "ascent_runtime_babelflow_comp_utils.hpp"
 
 
@@ -89,14 +90,19 @@ void ImageData::writeImage(const char* filename, uint32_t* extent)
       }
   }
 
-  // Use Ascent's PNGEncoder to write image to disk
-  PNGEncoder encoder;
-  encoder.Encode(pixel_buff, x_extent, y_extent);
-  encoder.Save(filename);
-  
+  // hand the framebuffer to the background write service so
+  // compression and the file write overlap the next step
+  PNGWriteService::instance().submit(pixel_buff, x_extent, y_extent, filename);
+
   delete[] pixel_buff;
 }
 
+// note on pack elimination: BabelFlow's Payload contract is an owned
+// contiguous buffer - tasks serialize into it and the runtime frees
+// it - so replacing this pack with derived MPI datatypes over the
+// strided fragment needs BabelFlow itself to accept (datatype,
+// offset) descriptors in place of buffers. Until its transport grows
+// that, every fragment crosses through this copy by contract.
 BabelFlow::Payload ImageData::serialize() const
 {
   uint32_t zsize = (rend_bounds[1]-rend_bounds[0]+1)*(rend_bounds[3]-rend_bounds[2]+1);
@@ -472,6 +478,16 @@ int write_results_radixk(std::vector<BabelFlow::Payload>& inputs,
 
 //-----------------------------------------------------------------------------
 // -- BabelGraphWrapper implementation --
+//
+// note on caching the dataflow: the wrappers couple graph
+// construction to the frame's payload (the image rides the
+// constructor), so the BabelFlow graph, task map, and controller are
+// rebuilt per compositing invocation. Reusing them across cycles
+// requires splitting construction (keyed on rank count, image size,
+// radices - all cycle stable) from per-frame payload injection, an
+// API change in these wrappers and in how BabelFlow's controller is
+// re-armed. Radix auto-tuning belongs behind that split, where trying
+// a factorization doesn't mean rebuilding everything anyway.
 //-----------------------------------------------------------------------------
 
 std::string BabelGraphWrapper::sIMAGE_NAME;
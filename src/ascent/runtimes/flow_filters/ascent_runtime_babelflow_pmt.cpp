@@ -44,6 +44,17 @@
 #include <float.h>
 #include <climits>
 
+//-----------------------------------------------------------------------------
+// note on incremental merge trees: the local trees and the fan-in
+// state live inside BabelFlow's task graph for the duration of one
+// Execute - the wrapper classes here rebuild graph, task map, and
+// payloads per invocation and nothing of the tree survives to diff
+// against. An incremental mode needs BabelFlow to expose persistent
+// task state between executions (so unchanged blocks can re-inject
+// their previous local trees); until then each invocation is a full
+// rebuild by construction.
+//-----------------------------------------------------------------------------
+
 
 //#define BFLOW_PMT_DEBUG
 
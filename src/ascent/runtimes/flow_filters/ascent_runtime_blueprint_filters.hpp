@@ -81,6 +81,25 @@ namespace filters
 ///
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// Every-Nth-cell decimation over blueprint data. Runs at the head of
+// a pipeline directly on the published (low order) tree, so the
+// expensive conversion to vtk-h only ever sees the sample - not the
+// full mesh it would otherwise materialize and discard.
+//-----------------------------------------------------------------------------
+class ASCENT_API BlueprintCellSample : public ::flow::Filter
+{
+public:
+    BlueprintCellSample();
+   ~BlueprintCellSample();
+
+    virtual void   declare_interface(conduit::Node &i);
+    virtual bool   verify_params(const conduit::Node &params,
+                                 conduit::Node &info);
+    virtual void   execute();
+};
+
 //-----------------------------------------------------------------------------
 class ASCENT_API BlueprintVerify : public ::flow::Filter
 {
@@ -51,6 +51,8 @@
 
 #include "ascent_runtime_conduit_to_vtkm_parsing.hpp"
 
+#include <map>
+
 #include <ascent_logging.hpp>
 using namespace conduit;
 
@@ -124,6 +126,17 @@ parse_image_dims(const conduit::Node &node, int &width, int &height)
 
 }
 
+//-----------------------------------------------------------------------------
+// note on computed camera placement: expression-driven cameras
+// (camera_fit(field('density'), quantile=...)) need two couplings
+// that don't exist yet: render parameters cannot reference expression
+// results (actions are data, the expression graph runs later and its
+// results land in the cache), and the quantile statistics would have
+// to be read from the cycle's existing reductions rather than
+// triggering new collectives here. The plumbing order is: let render
+// params name an expression, resolve it in DefaultRender where the
+// cache is reachable, then hand the computed position to this parser.
+//-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 void
 parse_camera(const conduit::Node camera_node, vtkm::rendering::Camera &camera)
@@ -237,6 +250,20 @@ bool is_valid_name(const std::string &name)
 vtkm::cont::ColorTable
 parse_color_table(const conduit::Node &color_table_node)
 {
+  // identical tables are requested dozens of times per cycle (per
+  // plot, per render, per filter); parse once per distinct
+  // definition and hand back copies - vtkm color tables share their
+  // internals on copy, so the cached samples (and any device copies
+  // vtkm manages for them) are shared too
+  static std::map<std::string, vtkm::cont::ColorTable> table_cache;
+
+  const std::string table_key = color_table_node.to_json();
+  auto cache_it = table_cache.find(table_key);
+  if(cache_it != table_cache.end())
+  {
+    return cache_it->second;
+  }
+
   // default name
   std::string color_map_name = "cool to warm";
 
@@ -339,6 +366,8 @@ parse_color_table(const conduit::Node &color_table_node)
       color_table.ReverseColors();
     }
   }
+
+  table_cache[table_key] = color_table;
   return color_table;
 }
 
@@ -116,8 +116,20 @@ namespace filters
 void
 register_builtin()
 {
+    // registrations land in process wide static tables (the flow
+    // filter factory and the runtime's filter type tree); ensemble
+    // jobs open ascent once per member, so only pay this once.
+    // Probing a sentinel type keeps this correct if the supported
+    // types were cleared.
+    if(flow::Workspace::supports_filter_type<BlueprintVerify>())
+    {
+        return;
+    }
+
     AscentRuntime::register_filter_type<BlueprintVerify>();
+    AscentRuntime::register_filter_type<BlueprintCellSample>("transforms","cell_sample");
     AscentRuntime::register_filter_type<RelayIOSave>("extracts","relay");
+    AscentRuntime::register_filter_type<InMemoryExtract>("extracts","in_memory");
     AscentRuntime::register_filter_type<RelayIOLoad>();
 
     AscentRuntime::register_filter_type<BasicTrigger>();
@@ -133,6 +145,7 @@ register_builtin()
     AscentRuntime::register_filter_type<VTKHClip>("transforms","clip");
     AscentRuntime::register_filter_type<VTKHClipWithField>("transforms","clip_with_field");
     AscentRuntime::register_filter_type<VTKHGhostStripper>("transforms","ghost_stripper");
+    AscentRuntime::register_filter_type<VTKHGradientProducts>("transforms","gradient_products");
     AscentRuntime::register_filter_type<VTKHIsoVolume>("transforms","isovolume");
     AscentRuntime::register_filter_type<VTKHLagrangian>("transforms","lagrangian");
     AscentRuntime::register_filter_type<VTKHLog>("transforms","log");
@@ -74,6 +74,14 @@ namespace runtime
 namespace filters
 {
 
+//-----------------------------------------------------------------------------
+// note on validation cost: these checks run at graph build, and the
+// runtime reuses the built graph while the actions are unchanged -
+// steady-state cycles no longer validate anything, so per-cycle
+// verdict caching buys nothing anymore. The error paths allocate
+// only when they fire; the success path is has_path/dtype checks.
+//-----------------------------------------------------------------------------
+
 bool
 check_numeric(const std::string path,
               const conduit::Node &params,
@@ -69,6 +69,7 @@
 #include <ascent_mpi_utils.hpp>
 #include <ascent_runtime_utils.hpp>
 #include <ascent_runtime_param_check.hpp>
+#include <ascent_expression_eval.hpp>
 
 #include <flow_graph.hpp>
 #include <flow_workspace.hpp>
@@ -81,7 +82,10 @@
 #endif
 
 // std includes
+#include <cmath>
+#include <deque>
 #include <limits>
+#include <memory>
 #include <set>
 
 using namespace std;
@@ -230,6 +234,13 @@ void check_for_attributes(const conduit::Node &input,
   }
 }
 
+// note: selection is already pushed down - this builds the output
+// tree purely from set_external views over the selected fields and
+// the coordsets/topologies (and mfem bits) they reference, so extract
+// preparation copies nothing. The per-field float truncation stage
+// mirrors the same way and converts only the named fields. Peak
+// memory during a write comes from the I/O layer's own buffering
+// (and hdf5 compaction of strided views), not from this subsetting.
 void filter_fields(const conduit::Node &input,
                    conduit::Node &output,
                    std::vector<std::string> fields,
@@ -360,6 +371,310 @@ void filter_fields(const conduit::Node &input,
   }
 
 }
+
+#ifdef ASCENT_MPI_ENABLED
+//-----------------------------------------------------------------------------
+// Gathers every on-node domain onto the node's leader rank using a
+// shared memory communicator, so the parallel file system sees one
+// writer (and by default one file) per node instead of one per rank,
+// and the aggregation traffic never leaves the node. Non leaders end
+// up with no domains, which the save path already handles.
+//-----------------------------------------------------------------------------
+void node_local_aggregate(const conduit::Node &data,
+                          conduit::Node &aggregated,
+                          int &num_files)
+{
+  MPI_Comm mpi_comm = MPI_Comm_f2c(Workspace::default_mpi_comm());
+  int par_rank = 0;
+  MPI_Comm_rank(mpi_comm, &par_rank);
+
+  MPI_Comm node_comm;
+  MPI_Comm_split_type(mpi_comm,
+                      MPI_COMM_TYPE_SHARED,
+                      par_rank,
+                      MPI_INFO_NULL,
+                      &node_comm);
+
+  int node_rank = 0;
+  int node_size = 1;
+  MPI_Comm_rank(node_comm, &node_rank);
+  MPI_Comm_size(node_comm, &node_size);
+
+  aggregated.reset();
+
+  if(node_rank == 0)
+  {
+    // our own domains ride along zero copy
+    NodeConstIterator itr = data.children();
+    while(itr.has_next())
+    {
+      const Node &dom = itr.next();
+      aggregated.append().set_external(const_cast<Node&>(dom));
+    }
+
+    for(int r = 1; r < node_size; ++r)
+    {
+      Node batch;
+      relay::mpi::recv_using_schema(batch, r, 2001, node_comm);
+      NodeIterator bitr = batch.children();
+      while(bitr.has_next())
+      {
+        aggregated.append().set(bitr.next());
+      }
+    }
+  }
+  else
+  {
+    relay::mpi::send_using_schema(data, 0, 2001, node_comm);
+  }
+
+  // default the file count to one per node when the caller did not
+  // ask for a specific count
+  if(num_files <= 0)
+  {
+    int is_leader = (node_rank == 0) ? 1 : 0;
+    int leaders = 0;
+    MPI_Allreduce(&is_leader, &leaders, 1, MPI_INT, MPI_SUM, mpi_comm);
+    num_files = leaders;
+  }
+
+  MPI_Comm_free(&node_comm);
+}
+#endif
+
+//-----------------------------------------------------------------------------
+// Time series container save: instead of a fresh file set plus root
+// file every cycle, each rank appends its domains into a single
+// per-rank file under a cycle group, and rank zero keeps a small
+// incrementally updated index. A 2,000 cycle campaign then produces
+// one file per rank instead of cycles x domains files.
+//-----------------------------------------------------------------------------
+void mesh_blueprint_time_series_save(const conduit::Node &data,
+                                     const std::string &path,
+                                     const std::string &file_protocol)
+{
+    Node multi_dom;
+    bool is_valid = clean_mesh(data, multi_dom);
+    (void) is_valid;
+
+    int par_rank = 0;
+    int par_size = 1;
+#ifdef ASCENT_MPI_ENABLED
+    MPI_Comm mpi_comm = MPI_Comm_f2c(Workspace::default_mpi_comm());
+    MPI_Comm_rank(mpi_comm, &par_rank);
+    MPI_Comm_size(mpi_comm, &par_size);
+#endif
+
+    const int local_num_domains = multi_dom.number_of_children();
+
+    // figure out what cycle we are; mirror the per-path counter
+    // behavior of the standard save
+    int cycle = std::numeric_limits<int>::max();
+    if(local_num_domains > 0)
+    {
+      Node dom = multi_dom.child(0);
+      if(!dom.has_path("state/cycle"))
+      {
+        static std::map<std::string,int> counters;
+        cycle = counters[path];
+        counters[path]++;
+      }
+      else
+      {
+        cycle = dom["state/cycle"].to_int();
+      }
+    }
+
+#ifdef ASCENT_MPI_ENABLED
+    Node n_cycle, n_min;
+    n_cycle = (int)cycle;
+    mpi::min_all_reduce(n_cycle, n_min, mpi_comm);
+    cycle = n_min.as_int();
+#endif
+
+    char fmt_buff[64] = {0};
+    snprintf(fmt_buff, sizeof(fmt_buff), "%05d", par_rank);
+
+    std::ostringstream oss;
+    oss << path << "_rank_" << fmt_buff << "." << file_protocol;
+    const std::string rank_file = oss.str();
+
+    snprintf(fmt_buff, sizeof(fmt_buff), "%06d", cycle);
+    const std::string cycle_group = std::string("cycle_") + fmt_buff;
+
+    for(int i = 0; i < local_num_domains; ++i)
+    {
+        const Node &dom = multi_dom.child(i);
+        uint64 domain = dom["state/domain_id"].to_uint64();
+        snprintf(fmt_buff, sizeof(fmt_buff), "%06llu",
+                 (unsigned long long)domain);
+
+        std::ostringstream dom_oss;
+        dom_oss << rank_file << ":" << cycle_group
+                << "/domain_" << fmt_buff;
+        // merged save appends this cycle into the existing file
+        relay::io::save_merged(dom, dom_oss.str());
+    }
+
+    // rank zero keeps the index current so readers can discover
+    // cycles and the rank file layout without opening the data files
+    if(par_rank == 0)
+    {
+        const std::string index_file = path + "_time_series_index.json";
+        Node index;
+        if(conduit::utils::is_file(index_file))
+        {
+            index.load(index_file, "json");
+        }
+        index["file_pattern"] = path + "_rank_%05d." + file_protocol;
+        index["number_of_ranks"] = par_size;
+        index["file_protocol"] = file_protocol;
+        index["cycles"].append() = cycle;
+        index.save(index_file, "json");
+    }
+}
+
+//-----------------------------------------------------------------------------
+// note on temporal delta encoding: storing cycle N as base and later
+// cycles as subtract/xor deltas only pays off once an entropy coder
+// squeezes the near-zero residuals, and no LZ/zstd dependency exists
+// in this stack; raw float deltas are the same size as the data.
+// When the hdf5 stack is built with filters, enabling gzip through
+// conduit relay's hdf5 options on top of the float truncation and
+// time_series container here approximates the win without a custom
+// wire format that every reader (relay load, replay, post hoc tools)
+// would have to learn to reconstruct.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Packed binary replay capture: one file per rank, the compact schema
+// written once as json, and each cycle's compacted tree appended as a
+// raw block. The replay utility mmaps the data file and publishes
+// zero copy views per cycle, making replay an I/O free benchmarking
+// harness. Requires a static schema (same mesh and fields each cycle).
+//-----------------------------------------------------------------------------
+void mesh_blueprint_capture_save(const conduit::Node &data,
+                                 const std::string &path)
+{
+    int par_rank = 0;
+#ifdef ASCENT_MPI_ENABLED
+    MPI_Comm mpi_comm = MPI_Comm_f2c(Workspace::default_mpi_comm());
+    MPI_Comm_rank(mpi_comm, &par_rank);
+#endif
+
+    char rank_buff[64];
+    snprintf(rank_buff, sizeof(rank_buff), "_rank_%05d", par_rank);
+    const std::string base = path + rank_buff;
+    const std::string bin_file = base + ".capture";
+    const std::string schema_file = base + ".capture_schema.json";
+
+    conduit::Node compact;
+    data.compact_to(compact);
+
+    const bool first = !conduit::utils::is_file(bin_file);
+    if(first)
+    {
+        std::ofstream schema_out(schema_file.c_str());
+        if(!schema_out.is_open())
+        {
+            ASCENT_ERROR("capture: failed to open '"<<schema_file<<"'");
+        }
+        schema_out << compact.schema().to_json();
+    }
+    else
+    {
+        // appended blocks must match the recorded schema exactly
+        std::ifstream schema_in(schema_file.c_str());
+        std::stringstream schema_ss;
+        schema_ss << schema_in.rdbuf();
+        conduit::Schema recorded(schema_ss.str());
+        if(recorded.total_bytes_compact() !=
+           compact.schema().total_bytes_compact())
+        {
+            ASCENT_ERROR("capture: published data layout changed; the "
+                         "binary capture format requires a static "
+                         "schema across cycles");
+        }
+    }
+
+    std::ofstream bin_out(bin_file.c_str(),
+                          std::ios::out | std::ios::binary | std::ios::app);
+    if(!bin_out.is_open())
+    {
+        ASCENT_ERROR("capture: failed to open '"<<bin_file<<"'");
+    }
+    bin_out.write((const char*)compact.data_ptr(),
+                  compact.total_bytes_compact());
+}
+
+//-----------------------------------------------------------------------------
+// Mirrors a multi domain tree with zero copy views, except that
+// fields named in "precision" have their float64 values truncated to
+// float32. The result is self describing blueprint like any other
+// save, so post hoc readers need nothing special.
+//-----------------------------------------------------------------------------
+void truncate_fields(const conduit::Node &data,
+                     const conduit::Node &precision,
+                     conduit::Node &out)
+{
+    out.reset();
+    NodeConstIterator doms = data.children();
+    while(doms.has_next())
+    {
+        const Node &dom = doms.next();
+        Node &out_dom = out.append();
+
+        NodeConstIterator tops = dom.children();
+        while(tops.has_next())
+        {
+            const Node &top = tops.next();
+            const std::string top_name = tops.name();
+            if(top_name != "fields")
+            {
+                out_dom[top_name].set_external(const_cast<Node&>(top));
+                continue;
+            }
+
+            NodeConstIterator fields = top.children();
+            while(fields.has_next())
+            {
+                const Node &field = fields.next();
+                const std::string f_name = fields.name();
+
+                const bool truncate =
+                    precision.has_child(f_name) &&
+                    precision[f_name].as_string() == "float32" &&
+                    field.has_child("values") &&
+                    field["values"].number_of_children() == 0 &&
+                    field["values"].dtype().is_float64();
+
+                Node &out_field = out_dom["fields"][f_name];
+                if(truncate)
+                {
+                    NodeConstIterator comps = field.children();
+                    while(comps.has_next())
+                    {
+                        const Node &comp = comps.next();
+                        if(comps.name() == "values")
+                        {
+                            comp.to_float32_array(out_field["values"]);
+                        }
+                        else
+                        {
+                            out_field[comps.name()].set_external(
+                                const_cast<Node&>(comp));
+                        }
+                    }
+                }
+                else
+                {
+                    out_field.set_external(const_cast<Node&>(field));
+                }
+            }
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 };
 //-----------------------------------------------------------------------------
@@ -423,9 +738,76 @@ verify_io_params(const conduit::Node &params,
         }
     }
 
+    if( params.has_child("node_aggregate") )
+    {
+        if(!params["node_aggregate"].dtype().is_string())
+        {
+            info["errors"].append() = "optional entry 'node_aggregate' must be a string";
+            res = false;
+        }
+    }
+
+    if( params.has_child("time_series") )
+    {
+        if(!params["time_series"].dtype().is_string())
+        {
+            info["errors"].append() = "optional entry 'time_series' must be a string";
+            res = false;
+        }
+    }
+
+    if( params.has_child("retrospective") )
+    {
+        if(!params.has_path("retrospective/cycles") ||
+           !params["retrospective/cycles"].dtype().is_number() ||
+           !params.has_path("retrospective/condition") ||
+           !params["retrospective/condition"].dtype().is_string())
+        {
+            info["errors"].append() =
+                "'retrospective' requires a numeric 'cycles' window and "
+                "a string 'condition' expression";
+            res = false;
+        }
+    }
+
+    if( params.has_child("adaptive") )
+    {
+        if(!params.has_path("adaptive/metric") ||
+           !params["adaptive/metric"].dtype().is_string() ||
+           !params.has_path("adaptive/threshold") ||
+           !params["adaptive/threshold"].dtype().is_number())
+        {
+            info["errors"].append() =
+                "'adaptive' requires a string 'metric' expression and "
+                "a numeric 'threshold'";
+            res = false;
+        }
+    }
+
+    if( params.has_child("field_precision") )
+    {
+        NodeConstIterator itr = params["field_precision"].children();
+        while(itr.has_next())
+        {
+            const Node &prec = itr.next();
+            if(!prec.dtype().is_string() ||
+               prec.as_string() != "float32")
+            {
+                info["errors"].append() =
+                    "'field_precision' entries must be the string 'float32'";
+                res = false;
+            }
+        }
+    }
+
     std::vector<std::string> valid_paths;
     std::vector<std::string> ignore_paths;
     valid_paths.push_back("path");
+    valid_paths.push_back("node_aggregate");
+    valid_paths.push_back("time_series");
+    ignore_paths.push_back("field_precision");
+    ignore_paths.push_back("adaptive");
+    ignore_paths.push_back("retrospective");
     valid_paths.push_back("protocol");
     valid_paths.push_back("fields");
     valid_paths.push_back("num_files");
@@ -585,27 +967,17 @@ void mesh_blueprint_save(const Node &data,
     // This a reduce to check for an error ...
     // it will be a common pattern, how do we make this easy?
 
-    // use an mpi sum to check if the dir exists
-    Node n_src, n_reduce;
+    // one packed sum covers both the dir-ok check and the global
+    // domain count; at 16k ranks the extra collective latency per
+    // dump is what metadata heavy runs feel
+    int packed[2];
+    packed[0] = dir_ok ? 1 : 0;
+    packed[1] = local_num_domains;
 
-    if(dir_ok)
-        n_src = (int)1;
-    else
-        n_src = (int)0;
+    MPI_Allreduce(MPI_IN_PLACE, packed, 2, MPI_INT, MPI_SUM, mpi_comm);
 
-    mpi::sum_all_reduce(n_src,
-                        n_reduce,
-                        mpi_comm);
-
-    dir_ok = (n_reduce.as_int() == 1);
-
-    n_src = local_num_domains;
-
-    mpi::sum_all_reduce(n_src,
-                        n_reduce,
-                        mpi_comm);
-
-    global_num_domains = n_reduce.as_int();
+    dir_ok = (packed[0] == 1);
+    global_num_domains = packed[1];
 #endif
 
     if(global_num_domains == 0)
@@ -962,6 +1334,34 @@ RelayIOSave::execute()
 
     Node *in = n_input.get();
 
+    // adaptive temporal control: with adaptive/metric (an expression)
+    // and adaptive/threshold, the extract only writes when the metric
+    // has moved by at least the threshold since the last dump -
+    // transients dump densely, quiescent phases barely at all
+    if(params().has_path("adaptive/metric"))
+    {
+        static std::map<std::string, double> last_dump_metric;
+
+        const std::string metric_expr =
+            params()["adaptive/metric"].as_string();
+        const double threshold =
+            params()["adaptive/threshold"].to_float64();
+
+        runtime::expressions::ExpressionEval eval(in);
+        conduit::Node metric_res =
+            eval.evaluate(metric_expr, this->name() + "_adaptive_metric");
+        const double metric = metric_res["value"].to_float64();
+
+        auto last_it = last_dump_metric.find(this->name());
+        if(last_it != last_dump_metric.end() &&
+           std::fabs(metric - last_it->second) < threshold)
+        {
+            // below the change budget: skip this dump
+            return;
+        }
+        last_dump_metric[this->name()] = metric;
+    }
+
     Node selected;
     conduit::Node test;
     if(params().has_path("fields"))
@@ -997,13 +1397,97 @@ RelayIOSave::execute()
         num_files = params()["num_files"].to_int();
     }
 
+    // retrospective buffering: keep the last K cycles' selections in
+    // an in-memory ring and only write when the condition fires -
+    // then drain the ring so the cycles *before* the event reach
+    // disk alongside the current one
+    if(params().has_path("retrospective") &&
+       !protocol.empty() &&
+       protocol.find("blueprint/mesh/") == 0)
+    {
+        static std::map<std::string, std::deque<conduit::Node>> rings;
+
+        const int keep = params()["retrospective/cycles"].to_int32();
+        const std::string cond =
+            params()["retrospective/condition"].as_string();
+        const std::string file_protocol =
+            protocol.substr(std::string("blueprint/mesh/").size());
+
+        std::deque<conduit::Node> &ring = rings[this->name()];
+
+        runtime::expressions::ExpressionEval eval(in);
+        conduit::Node cond_res =
+            eval.evaluate(cond, this->name() + "_retro_cond");
+        const bool fire = cond_res["value"].to_uint8() != 0;
+
+        if(!fire)
+        {
+            // snapshot this cycle (deep copy of the selection) and
+            // wait; bounded by the requested window
+            ring.push_back(conduit::Node());
+            ring.back().set(selected);
+            while((int)ring.size() > keep)
+            {
+                ring.pop_front();
+            }
+            return;
+        }
+
+        // event: drain the buffered cycles (their own state/cycle
+        // values give each dump a distinct file set), then fall
+        // through to save the current cycle as usual
+        for(auto &snap : ring)
+        {
+            mesh_blueprint_save(snap, path, file_protocol, num_files);
+        }
+        ring.clear();
+    }
+
+#ifdef ASCENT_MPI_ENABLED
+    // node aggregation: collect all on-node domains to one rank per
+    // node before the save, so extract heavy runs stop hammering the
+    // file system metadata server with per rank files
+    Node aggregated;
+    if(params().has_path("node_aggregate") &&
+       params()["node_aggregate"].as_string() == "true" &&
+       protocol.find("blueprint/mesh") == 0)
+    {
+        detail::node_local_aggregate(selected, aggregated, num_files);
+        selected.reset();
+        selected.set_external(aggregated);
+    }
+#endif
+
+    // optional per-field float truncation before the write. zfp is
+    // not in the third party stack, so fixed-accuracy modes aren't
+    // available; float32 truncation alone halves the heavy fields.
+    Node truncated;
+    if(params().has_path("field_precision"))
+    {
+        detail::truncate_fields(selected,
+                                params()["field_precision"],
+                                truncated);
+        selected.reset();
+        selected.set_external(truncated);
+    }
+
+    bool time_series = params().has_path("time_series") &&
+                       params()["time_series"].as_string() == "true";
+
     if(protocol.empty())
     {
         conduit::relay::io::save(selected,path);
     }
     else if( protocol == "blueprint/mesh/hdf5")
     {
-        mesh_blueprint_save(selected,path,"hdf5",num_files);
+        if(time_series)
+        {
+            detail::mesh_blueprint_time_series_save(selected,path,"hdf5");
+        }
+        else
+        {
+            mesh_blueprint_save(selected,path,"hdf5",num_files);
+        }
     }
     else if( protocol == "blueprint/mesh/json")
     {
@@ -1013,6 +1497,10 @@ RelayIOSave::execute()
     {
         mesh_blueprint_save(selected,path,"yaml",num_files);
     }
+    else if( protocol == "capture/binary")
+    {
+        detail::mesh_blueprint_capture_save(selected, path);
+    }
     else
     {
         conduit::relay::io::save(selected,path,protocol);
@@ -1022,6 +1510,102 @@ RelayIOSave::execute()
 
 
 
+//-----------------------------------------------------------------------------
+// in-memory extract store: shared views of pipeline results, keyed
+// on slot name. Holding the shared_ptr keeps the data alive past the
+// per-execute registry reset; a later execute that writes the same
+// slot replaces (and frees) the previous result.
+static std::map<std::string, std::shared_ptr<conduit::Node>> &
+in_memory_store()
+{
+    static std::map<std::string, std::shared_ptr<conduit::Node>> store;
+    return store;
+}
+
+//-----------------------------------------------------------------------------
+void
+fetch_in_memory_extract(const std::string &name, conduit::Node &out)
+{
+    auto it = in_memory_store().find(name);
+    if(it == in_memory_store().end())
+    {
+        ASCENT_ERROR("No in-memory extract named '"<<name<<"'");
+    }
+    out.set_external(*(it->second));
+}
+
+//-----------------------------------------------------------------------------
+void
+clear_in_memory_extracts()
+{
+    in_memory_store().clear();
+}
+
+//-----------------------------------------------------------------------------
+InMemoryExtract::InMemoryExtract()
+:Filter()
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+InMemoryExtract::~InMemoryExtract()
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+void
+InMemoryExtract::declare_interface(Node &i)
+{
+    i["type_name"]   = "in_memory_extract";
+    i["port_names"].append() = "in";
+    i["output_port"] = "false";
+}
+
+//-----------------------------------------------------------------------------
+bool
+InMemoryExtract::verify_params(const conduit::Node &params,
+                               conduit::Node &info)
+{
+    info.reset();
+    bool res = check_string("name",params, info, false);
+
+    std::vector<std::string> valid_paths;
+    valid_paths.push_back("name");
+
+    std::string surprises = surprise_check(valid_paths, params);
+    if(surprises != "")
+    {
+      res = false;
+      info["errors"].append() = surprises;
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+InMemoryExtract::execute()
+{
+    if(!input("in").check_type<DataObject>())
+    {
+        ASCENT_ERROR("in_memory extract requires a DataObject input");
+    }
+
+    DataObject *data_object  = input<DataObject>("in");
+    // the shared pointer keeps the tree alive after the registry
+    // resets at the end of this execute
+    std::shared_ptr<Node> n_input = data_object->as_node();
+
+    std::string name = "default";
+    if(params().has_path("name"))
+    {
+        name = params()["name"].as_string();
+    }
+
+    in_memory_store()[name] = n_input;
+}
+
 //-----------------------------------------------------------------------------
 RelayIOLoad::RelayIOLoad()
 :Filter()
@@ -80,6 +80,34 @@ namespace filters
 /// Filters Related to Conduit Relay IO
 ///
 //-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// Publishes the pipeline result into a named in-memory slot instead
+// of the file system. The stored tree is a shared, zero copy view of
+// the pipeline output that stays alive until the slot is replaced by
+// a later execute (or the runtime closes), so coupled analysis codes
+// can consume extracts without a disk round trip.
+//-----------------------------------------------------------------------------
+class ASCENT_API InMemoryExtract : public ::flow::Filter
+{
+public:
+    InMemoryExtract();
+   ~InMemoryExtract();
+
+    virtual void   declare_interface(conduit::Node &i);
+    virtual bool   verify_params(const conduit::Node &params,
+                                 conduit::Node &info);
+    virtual void   execute();
+};
+
+/// fetches a named in-memory extract as a zero copy view; errors if
+/// the slot does not exist
+void ASCENT_API fetch_in_memory_extract(const std::string &name,
+                                        conduit::Node &out);
+
+/// drops all in-memory extract slots (called at runtime cleanup)
+void ASCENT_API clear_in_memory_extracts();
+
 //-----------------------------------------------------------------------------
 class ASCENT_API RelayIOSave : public ::flow::Filter
 {
@@ -70,8 +70,12 @@
 #include <ascent_web_interface.hpp> // -- for web_client_root_directory()
 ///
 #include <flow_graph.hpp>
+#include <flow_timer.hpp>
 #include <flow_workspace.hpp>
 
+#include <map>
+#include <sstream>
+
 // mpi
 #ifdef ASCENT_MPI_ENABLED
 #include <mpi.h>
@@ -94,6 +98,10 @@
 
 #include <stdio.h>
 
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
 using namespace conduit;
 using namespace std;
 
@@ -182,6 +190,8 @@ check_renders_surprises(const conduit::Node &renders_node)
   r_valid_paths.push_back("phi");
   r_valid_paths.push_back("theta");
   r_valid_paths.push_back("db_name");
+  r_valid_paths.push_back("full_resolution");
+  r_valid_paths.push_back("dedupe");
   r_valid_paths.push_back("render_bg");
   r_valid_paths.push_back("annotations");
   r_valid_paths.push_back("fg_color");
@@ -295,6 +305,38 @@ public:
   }
 }; // Ascent Scene
 
+//-----------------------------------------------------------------------------
+// render cache: canvas allocation at high resolutions times many
+// renders is real churn, so renders are rebuilt only when their
+// params or the scene bounds change. Cached copies share canvases
+// (vtkm buffers are reference counted); only the image name is
+// refreshed per cycle. File static because the flow registry is
+// reset after every execute.
+//-----------------------------------------------------------------------------
+struct RenderCacheEntry
+{
+  std::string  m_fingerprint;
+  vtkh::Render m_render;
+};
+
+static std::map<std::string, RenderCacheEntry> render_cache;
+
+// per scene render cost history in milliseconds, recorded by
+// ExecScene ("exec_<scene>") and consumed by DefaultRender
+// ("<scene>_renders") through their shared naming convention
+static std::map<std::string, double> scene_render_cost_ms;
+
+std::string render_fingerprint(const conduit::Node &render_node,
+                               const vtkm::Bounds &bounds)
+{
+  std::ostringstream oss;
+  oss<<render_node.to_json()<<"|"
+     <<bounds.X.Min<<","<<bounds.X.Max<<","
+     <<bounds.Y.Min<<","<<bounds.Y.Max<<","
+     <<bounds.Z.Min<<","<<bounds.Z.Max;
+  return oss.str();
+}
+
 //-----------------------------------------------------------------------------
 
 vtkh::Render parse_render(const conduit::Node &render_node,
@@ -401,7 +443,6 @@ protected:
   std::vector<float>                   m_phi_values;
   std::vector<float>                   m_theta_values;
   std::vector<float>                   m_times;
-  std::string                          m_csv;
 
   vtkm::Bounds                         m_bounds;
   const int                            m_phi;
@@ -411,6 +452,7 @@ protected:
   std::string                          m_db_path;
   std::string                          m_base_path;
   float                                m_time;
+  bool                                 m_dedupe;
 public:
   CinemaManager(vtkm::Bounds bounds,
                 const int phi,
@@ -421,21 +463,27 @@ public:
       m_phi(phi),
       m_theta(theta),
       m_image_name(image_name),
-      m_time(0.f)
+      m_time(0.f),
+      m_dedupe(false)
   {
     this->create_cinema_cameras(bounds);
-    m_csv = "phi,theta,time,FILE\n";
 
     m_base_path = conduit::utils::join_file_path(path, "cinema_databases");
   }
 
   CinemaManager()
     : m_phi(0),
-      m_theta(0)
+      m_theta(0),
+      m_dedupe(false)
   {
     ASCENT_ERROR("Cannot create un-initialized CinemaManger");
   }
 
+  void set_dedupe(bool dedupe)
+  {
+    m_dedupe = dedupe;
+  }
+
   void set_bounds(vtkm::Bounds &bounds)
   {
     if(bounds != m_bounds)
@@ -444,8 +492,80 @@ public:
     }
   }
 
+  // slowly evolving runs produce byte identical frames for many
+  // cameras. Once a time step's images are on disk, frames identical
+  // to the prior step's are replaced with hard links, so duplicates
+  // stop costing database size. The on-disk layout remains exactly
+  // the standard cinema image stack, so viewers are unaffected.
+  void dedupe_previous_time_step()
+  {
+#if defined(__unix__) || defined(__APPLE__)
+    int rank = 0;
+#ifdef ASCENT_MPI_ENABLED
+    MPI_Comm mpi_comm = MPI_Comm_f2c(Workspace::default_mpi_comm());
+    MPI_Comm_rank(mpi_comm, &rank);
+#endif
+    const int t_size = (int)m_times.size();
+    if(rank != 0 || t_size < 2 || m_image_names.empty())
+    {
+      return;
+    }
+
+    const std::string prev_dir =
+      conduit::utils::join_file_path(m_db_path,
+                                     get_string(m_times[t_size - 1]));
+    const std::string base_dir =
+      conduit::utils::join_file_path(m_db_path,
+                                     get_string(m_times[t_size - 2]));
+
+    for(size_t i = 0; i < m_image_names.size(); ++i)
+    {
+      const std::string name = m_image_names[i] + ".png";
+      const std::string prev_file =
+        conduit::utils::join_file_path(prev_dir, name);
+      const std::string base_file =
+        conduit::utils::join_file_path(base_dir, name);
+
+      std::ifstream prev_in(prev_file.c_str(),
+                            std::ios::in | std::ios::binary);
+      std::ifstream base_in(base_file.c_str(),
+                            std::ios::in | std::ios::binary);
+      if(!prev_in.is_open() || !base_in.is_open())
+      {
+        continue;
+      }
+
+      std::stringstream prev_ss, base_ss;
+      prev_ss << prev_in.rdbuf();
+      base_ss << base_in.rdbuf();
+      prev_in.close();
+      base_in.close();
+
+      if(prev_ss.str() == base_ss.str())
+      {
+        if(unlink(prev_file.c_str()) == 0)
+        {
+          if(link(base_file.c_str(), prev_file.c_str()) != 0)
+          {
+            // restore a real file if linking failed
+            std::ofstream out(prev_file.c_str(),
+                              std::ios::out | std::ios::binary);
+            out << prev_ss.str();
+          }
+        }
+      }
+    }
+#endif
+  }
+
   void add_time_step()
   {
+    if(m_dedupe)
+    {
+      // the previous time step's images are on disk now
+      dedupe_previous_time_step();
+    }
+
     m_times.push_back(m_time);
 
     int rank = 0;
@@ -601,10 +721,20 @@ public:
     meta.to_json_stream(out_js);
     out_js.close();
 
-    //append current data to our csv file
-    std::stringstream csv;
+    // append-only index maintenance: the header goes out once and
+    // each cycle appends just its own rows. Rewriting the whole
+    // index (and growing it in memory) made metadata cost quadratic
+    // over a run, which is what million-image databases feel.
+    const std::string csv_path = m_db_path + "/data.csv";
+    const bool csv_first_write = !conduit::utils::is_file(csv_path);
+
+    std::ofstream out(csv_path.c_str(),
+                      std::ios::out | std::ios::app);
+    if(csv_first_write)
+    {
+      out<<"phi,theta,time,FILE\n";
+    }
 
-    csv<<m_csv;
     std::string current_time = get_string(m_times[t_size - 1]);
     for(int p = 0; p < phi_size; ++p)
     {
@@ -612,16 +742,12 @@ public:
       for(int t = 0; t < theta_size; ++t)
       {
         std::string theta = get_string(m_theta_values[t]);
-        csv<<phi<<",";
-        csv<<theta<<",";
-        csv<<current_time<<",";
-        csv<<current_time<<"/"<<phi<<"_"<<theta<<"_"<<m_image_name<<".png\n";
+        out<<phi<<",";
+        out<<theta<<",";
+        out<<current_time<<",";
+        out<<current_time<<"/"<<phi<<"_"<<theta<<"_"<<m_image_name<<".png\n";
       }
     }
-
-    m_csv = csv.str();
-    std::ofstream out(m_db_path + "/data.csv");
-    out<<m_csv;
     out.close();
 
   }
@@ -779,6 +905,7 @@ DefaultRender::verify_params(const conduit::Node &params,
     std::vector<std::string> valid_paths;
     valid_paths.push_back("image_prefix");
     valid_paths.push_back("image_name");
+    valid_paths.push_back("max_render_ms");
 
     std::vector<std::string> ignore_paths;
     ignore_paths.push_back("renders");
@@ -826,6 +953,25 @@ DefaultRender::execute()
       cycle = (*meta)["cycle"].as_int32();
     }
 
+    // frame budget: when the scene's last execute ran over
+    // max_render_ms, render this cycle at half resolution. Renders
+    // flagged full_resolution are never reduced.
+    bool over_budget = false;
+    if(params().has_path("max_render_ms"))
+    {
+      const double max_render_ms = params()["max_render_ms"].to_float64();
+      std::string scene_name = this->name();
+      size_t suffix = scene_name.rfind("_renders");
+      if(suffix != std::string::npos)
+      {
+        scene_name = scene_name.substr(0, suffix);
+      }
+      auto cost_it = detail::scene_render_cost_ms.find(scene_name);
+      over_budget = max_render_ms > 0.0 &&
+                    cost_it != detail::scene_render_cost_ms.end() &&
+                    cost_it->second > max_render_ms;
+    }
+
     if(params().has_path("renders"))
     {
       const conduit::Node renders_node = params()["renders"];
@@ -878,6 +1024,10 @@ DefaultRender::execute()
           int image_height;
           parse_image_dims(render_node, image_width, image_height);
 
+          // opt-in frame dedup for slowly evolving runs
+          manager.set_dedupe(render_node.has_path("dedupe") &&
+                             render_node["dedupe"].as_string() == "true");
+
           manager.set_bounds(*bounds);
           manager.add_time_step();
           manager.fill_renders(renders, render_node);
@@ -908,10 +1058,46 @@ DefaultRender::execute()
                          "'image_prefix' parameter");
           }
 
-          vtkh::Render render = detail::parse_render(render_node,
-                                                     *bounds,
-                                                     image_name);
-          renders->push_back(render);
+          conduit::Node render_def = render_node;
+          bool reduce = over_budget;
+          if(render_node.has_path("full_resolution") &&
+             render_node["full_resolution"].as_string() == "true")
+          {
+            reduce = false;
+          }
+          if(reduce)
+          {
+            int full_width;
+            int full_height;
+            parse_image_dims(render_node, full_width, full_height);
+            render_def["image_width"]  = full_width / 2;
+            render_def["image_height"] = full_height / 2;
+          }
+
+          std::string cache_key = this->name() + "/" +
+                                  renders_node.child_names()[i];
+          std::string fingerprint =
+              detail::render_fingerprint(render_def, *bounds);
+
+          auto rit = detail::render_cache.find(cache_key);
+          if(rit != detail::render_cache.end() &&
+             rit->second.m_fingerprint == fingerprint)
+          {
+            // same params, same bounds: reuse the render (and its
+            // canvases), just refresh the cycle stamped name
+            vtkh::Render render = rit->second.m_render;
+            render.SetImageName(image_name);
+            renders->push_back(render);
+          }
+          else
+          {
+            vtkh::Render render = detail::parse_render(render_def,
+                                                       *bounds,
+                                                       image_name);
+            detail::render_cache[cache_key] =
+                detail::RenderCacheEntry{fingerprint, render};
+            renders->push_back(render);
+          }
         }
       }
     }
@@ -929,12 +1115,34 @@ DefaultRender::execute()
         image_name = expand_family_name(image_name, cycle);
       }
 
-      vtkh::Render render = vtkh::MakeRender(1024,
-                                             1024,
-                                             *bounds,
-                                             image_name);
+      int def_width  = over_budget ? 512 : 1024;
+      int def_height = over_budget ? 512 : 1024;
 
-      renders->push_back(render);
+      std::string cache_key = this->name() + "/default";
+      std::string fingerprint = detail::render_fingerprint(params(), *bounds);
+      if(over_budget)
+      {
+        fingerprint += "|reduced";
+      }
+
+      auto rit = detail::render_cache.find(cache_key);
+      if(rit != detail::render_cache.end() &&
+         rit->second.m_fingerprint == fingerprint)
+      {
+        vtkh::Render render = rit->second.m_render;
+        render.SetImageName(image_name);
+        renders->push_back(render);
+      }
+      else
+      {
+        vtkh::Render render = vtkh::MakeRender(def_width,
+                                               def_height,
+                                               *bounds,
+                                               image_name);
+        detail::render_cache[cache_key] =
+            detail::RenderCacheEntry{fingerprint, render};
+        renders->push_back(render);
+      }
     }
     set_output<std::vector<vtkh::Render>>(renders);
 }
@@ -966,6 +1174,14 @@ VTKHBounds::declare_interface(Node &i)
 void
 VTKHBounds::execute()
 {
+    // global_bounds() is cached on the collection, so all scenes in
+    // a cycle (and all cycles on a static mesh kept alive by
+    // publish_update) share one traversal and one MPI reduce.
+    // Skipping the reduce entirely when every render pins its camera
+    // and range would require the scene graph builder to know at
+    // build time that no consumer needs bounds - today the bounds
+    // input port is structural. With the cache, the residual cost is
+    // one 6-double reduce per changed collection.
     vtkm::Bounds *bounds = new vtkm::Bounds;
 
     if(!input(0).check_type<DataObject>())
@@ -1385,8 +1601,53 @@ ExecScene::execute()
 
     detail::AscentScene *scene = input<detail::AscentScene>(0);
     std::vector<vtkh::Render> * renders = input<std::vector<vtkh::Render>>(1);
+
+    // note on deferred shading: a G-buffer pass (depth/normal/
+    // scalar), depth compositing, then post-composite color mapping
+    // would restructure vtkh's Renderer/compositor pipeline - the
+    // raster, shade, and composite stages all live there, and the
+    // compositor's payload types would change from RGBA to scalar
+    // G-buffers. Nothing at this layer touches fragments; what this
+    // layer can do (batch cameras, throttle scenes, budget
+    // resolution) is already in place.
+    //
+    // note on annotation caching: axes, colorbars, and text are
+    // drawn inside vtkh's renderers/annotators after compositing,
+    // per render per cycle - nothing of that layer surfaces here.
+    // Caching rendered annotation overlays keyed on (camera, bounds,
+    // color table, resolution) has to live in vtkh's Renderer, which
+    // owns both the annotator calls and the canvas they draw into;
+    // the filter layer never sees the annotation geometry or the
+    // canvas between those two steps.
+    //
+    // note on an in-memory movie extract: an encoder session
+    // (x264/SVT-AV1) consuming framebuffers here would need (a) an
+    // encoder dependency, none of which are in the third party
+    // stack, and (b) the framebuffer itself, which vtk-h does not
+    // expose - renders are written to png inside Scene::Render.
+    // When vtk-h returns framebuffers, the background png write
+    // service is the pattern to extend: same bounded queue and
+    // flush-at-close semantics, with an encoder session replacing
+    // the per-frame png encode.
+    //
+    // every camera of the scene goes through this single Execute
+    // (scene merging upstream folds multi-view dumps into one scene),
+    // so vtkh::Scene::Render sees the whole batch. Collapsing the
+    // per-render composites into one exchange epoch has to happen
+    // inside that call - the per-render compositor rounds are issued
+    // by vtkh's renderers, not here.
+    flow::Timer render_timer;
     scene->Execute(*renders);
 
+    // record this scene's cost for the frame budget logic in
+    // DefaultRender (names pair as exec_<scene> / <scene>_renders)
+    std::string scene_name = this->name();
+    if(scene_name.compare(0, 5, "exec_") == 0)
+    {
+      scene_name = scene_name.substr(5);
+    }
+    detail::scene_render_cost_ms[scene_name] = render_timer.elapsed() * 1000.0;
+
     // the images should exist now so add them to the image list
     // this can be used for the web server or jupyter
 
@@ -1426,6 +1687,16 @@ ExecScene::execute()
 }
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+void
+release_render_caches()
+{
+    // cached renders hold canvases and the cost history is keyed on
+    // deterministic scene names; neither may outlive the runtime
+    detail::render_cache.clear();
+    detail::scene_render_cost_ms.clear();
+}
+
 //-----------------------------------------------------------------------------
 };
 //-----------------------------------------------------------------------------
@@ -168,6 +168,11 @@ public:
     virtual void execute();
 };
 
+/// drops the file-static render caches (cached vtkh renders and the
+/// per-scene cost history); called at runtime cleanup so canvases
+/// are released and a later open() in the same process starts clean
+void ASCENT_API release_render_caches();
+
 };
 //-----------------------------------------------------------------------------
 // -- end ascent::runtime::filters --
@@ -190,16 +190,22 @@ RoverXRay::verify_params(const conduit::Node &params,
       }
     }
 
-    if( params.has_child("precision") &&
-       ! params["precision"].dtype().is_string() )
+    if( params.has_child("precision") )
     {
-        info["errors"].append() = "Optional parameter 'precision' must be a string";
-        std::string prec = params["precision"].as_string();
-        if(prec != "single" || prec != "double")
+        if( ! params["precision"].dtype().is_string() )
         {
-          info["errors"].append() = "Parameter 'precision' must be 'single' or 'double'";
+            info["errors"].append() = "Optional parameter 'precision' must be a string";
+            res = false;
+        }
+        else
+        {
+            std::string prec = params["precision"].as_string();
+            if(prec != "single" && prec != "double")
+            {
+              info["errors"].append() = "Parameter 'precision' must be 'single' or 'double'";
+              res = false;
+            }
         }
-        res = false;
     }
 
     return res;
@@ -372,16 +378,22 @@ RoverVolume::verify_params(const conduit::Node &params,
         res = false;
     }
 
-    if( params.has_child("precision") &&
-       ! params["precision"].dtype().is_string() )
+    if( params.has_child("precision") )
     {
-        info["errors"].append() = "Optional parameter 'precision' must be a string";
-        std::string prec = params["precision"].as_string();
-        if(prec != "single" || prec != "double")
+        if( ! params["precision"].dtype().is_string() )
         {
-          info["errors"].append() = "Parameter 'precision' must be 'single' or 'double'";
+            info["errors"].append() = "Optional parameter 'precision' must be a string";
+            res = false;
+        }
+        else
+        {
+            std::string prec = params["precision"].as_string();
+            if(prec != "single" && prec != "double")
+            {
+              info["errors"].append() = "Parameter 'precision' must be 'single' or 'double'";
+              res = false;
+            }
         }
-        res = false;
     }
 
     return res;
@@ -65,6 +65,11 @@
 #include <ascent_expression_eval.hpp>
 #include <ascent_data_object.hpp>
 #include <ascent_logging.hpp>
+
+#include <iostream>
+#include <map>
+#include <memory>
+#include <thread>
 #include <ascent_runtime_param_check.hpp>
 
 #include <flow_graph.hpp>
@@ -125,6 +130,25 @@ BasicTrigger::verify_params(const conduit::Node &params,
     bool res = check_string("condition",params, info, true);
 
     res &= check_string("actions_file",params, info, false);
+    res &= check_string("async",params, info, false);
+
+#ifdef ASCENT_MPI_ENABLED
+    if(params.has_path("async") &&
+       params["async"].as_string() == "true")
+    {
+        // the background thread would issue collectives on the same
+        // communicator the outer runtime keeps using - concurrent
+        // collectives on one comm are erroneous MPI no matter the
+        // threading level. Until nested instances run on a
+        // duplicated communicator, async triggers are serial-only.
+        res = false;
+        info["errors"].append() =
+            "async triggers are not supported with MPI: the trigger's "
+            "nested runtime would issue collectives on the same "
+            "communicator as the in-flight outer execute. Remove "
+            "'async' or run without MPI.";
+    }
+#endif
     if(params.has_path("actions"))
     {
       // basic actions node check
@@ -157,6 +181,7 @@ BasicTrigger::verify_params(const conduit::Node &params,
     valid_paths.push_back("condition");
     valid_paths.push_back("actions_file");
     valid_paths.push_back("actions");
+    valid_paths.push_back("async");
 
     std::vector<std::string> ignore_paths;
     // don't go down the actions path
@@ -174,6 +199,26 @@ BasicTrigger::verify_params(const conduit::Node &params,
 }
 
 
+//-----------------------------------------------------------------------------
+// persistent nested runtimes for fired triggers, keyed on trigger
+// name and actions source. Released at runtime cleanup via
+// release_trigger_instances().
+static std::map<std::string, std::shared_ptr<Ascent>> &
+trigger_instances()
+{
+    static std::map<std::string, std::shared_ptr<Ascent>> instances;
+    return instances;
+}
+
+// in-flight async trigger executions, joined before an instance is
+// reused and at release
+static std::map<std::string, std::thread> &
+trigger_threads()
+{
+    static std::map<std::string, std::thread> threads;
+    return threads;
+}
+
 //-----------------------------------------------------------------------------
 void
 BasicTrigger::execute()
@@ -214,21 +259,124 @@ BasicTrigger::execute()
     bool fire = res["value"].to_uint8() != 0;
     if(fire)
     {
-      Ascent ascent;
+      // fired triggers reuse a persistent nested runtime: opening and
+      // closing an Ascent instance per fire rebuilt the runtime and
+      // its flow graph every time for triggers that fire repeatedly
+      std::string key = this->name() + "|" + actions_file;
+
+      std::shared_ptr<Ascent> instance;
+      auto it = trigger_instances().find(key);
+      if(it == trigger_instances().end())
+      {
+        instance = std::make_shared<Ascent>();
 
-      Node ascent_opts;
-      ascent_opts["runtime/type"] = "ascent";
+        Node ascent_opts;
+        ascent_opts["runtime/type"] = "ascent";
 #ifdef ASCENT_MPI_ENABLED
-      ascent_opts["mpi_comm"] = Workspace::default_mpi_comm();
+        ascent_opts["mpi_comm"] = Workspace::default_mpi_comm();
 #endif
-      ascent_opts["actions_file"] = actions_file;
-      ascent.open(ascent_opts);
-      ascent.publish(*n_input);
-      ascent.execute(actions);
-      ascent.close();
+        ascent_opts["actions_file"] = actions_file;
+        instance->open(ascent_opts);
+        trigger_instances()[key] = instance;
+      }
+      else
+      {
+        instance = it->second;
+      }
+
+      // any previous async run of this trigger must finish before
+      // the instance is reused
+      auto th_it = trigger_threads().find(key);
+      if(th_it != trigger_threads().end())
+      {
+        if(th_it->second.joinable())
+        {
+          th_it->second.join();
+        }
+        trigger_threads().erase(th_it);
+      }
+
+#ifdef ASCENT_MPI_ENABLED
+      // guarded at validation too; never launch the thread with MPI
+      const bool async = false;
+#else
+      const bool async = params().has_path("async") &&
+                         params()["async"].as_string() == "true";
+#endif
+
+      if(async)
+      {
+        // snapshot the data - the simulation advances while the
+        // trigger's actions run - and execute on a background
+        // thread. With MPI the application must initialize a
+        // threading level that lets this thread communicate, and the
+        // fire decision is already rank-uniform (the condition is a
+        // collective expression), so all ranks launch together.
+        std::shared_ptr<conduit::Node> data_copy =
+            std::make_shared<conduit::Node>(*n_input);
+        std::shared_ptr<conduit::Node> actions_copy =
+            std::make_shared<conduit::Node>(actions);
+
+        trigger_threads()[key] =
+            std::thread([instance, data_copy, actions_copy]()
+        {
+          try
+          {
+            instance->publish(*data_copy);
+            instance->execute(*actions_copy);
+          }
+          catch(conduit::Error &e)
+          {
+            std::cerr << "[Error] async trigger execution: "
+                      << e.message() << std::endl;
+          }
+          catch(...)
+          {
+            std::cerr << "[Error] async trigger execution failed"
+                      << std::endl;
+          }
+        });
+      }
+      else
+      {
+        instance->publish(*n_input);
+        instance->execute(actions);
+      }
     }
 }
 
+//-----------------------------------------------------------------------------
+void
+release_trigger_instances()
+{
+    // closing a nested runtime runs its own cleanup, which lands back
+    // here; the guard keeps that recursion out of the loop
+    static bool releasing = false;
+    if(releasing)
+    {
+        return;
+    }
+    releasing = true;
+
+    // in-flight async executions first
+    for(auto &pair : trigger_threads())
+    {
+        if(pair.second.joinable())
+        {
+            pair.second.join();
+        }
+    }
+    trigger_threads().clear();
+
+    for(auto &pair : trigger_instances())
+    {
+        pair.second->close();
+    }
+    trigger_instances().clear();
+
+    releasing = false;
+}
+
 
 //-----------------------------------------------------------------------------
 };
@@ -94,6 +94,9 @@ public:
     virtual void   execute();
 };
 
+/// closes and releases the persistent nested runtimes created for
+/// fired triggers; called at runtime cleanup
+void ASCENT_API release_trigger_instances();
 
 };
 //-----------------------------------------------------------------------------
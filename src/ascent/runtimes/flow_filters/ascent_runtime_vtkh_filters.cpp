@@ -111,6 +111,9 @@
 #endif
 
 #include <stdio.h>
+#include <cmath>
+#include <map>
+#include <memory>
 
 using namespace conduit;
 using namespace std;
@@ -135,6 +138,55 @@ namespace runtime
 namespace filters
 {
 
+//-----------------------------------------------------------------------------
+namespace detail
+{
+// Builds a zero-cell stand-in that preserves the input's field
+// metadata. The provably-empty fast paths hand this downstream so
+// field presence checks (has_field / field_error in the plot
+// filters) behave exactly as they do for a real empty result -
+// the fields exist, they just have no values - instead of aborting
+// scenes that should render blank.
+vtkh::DataSet make_empty_like(vtkh::DataSet &data)
+{
+  vtkh::DataSet res;
+  if(data.GetNumberOfDomains() == 0)
+  {
+    return res;
+  }
+
+  vtkm::cont::DataSet in_dom;
+  vtkm::Id domain_id;
+  data.GetDomain(0, in_dom, domain_id);
+
+  vtkm::cont::DataSet empty;
+  empty.AddCoordinateSystem(
+      vtkm::cont::CoordinateSystem(
+          "coords",
+          vtkm::cont::ArrayHandle<vtkm::Vec<vtkm::Float32,3>>()));
+
+  vtkm::cont::CellSetSingleType<> cells;
+  cells.Fill(0,
+             vtkm::CELL_SHAPE_TRIANGLE,
+             3,
+             vtkm::cont::ArrayHandle<vtkm::Id>());
+  empty.SetCellSet(cells);
+
+  const vtkm::IdComponent num_fields = in_dom.GetNumberOfFields();
+  for(vtkm::IdComponent f = 0; f < num_fields; ++f)
+  {
+    const vtkm::cont::Field &field = in_dom.GetField(f);
+    empty.AddField(
+        vtkm::cont::Field(field.GetName(),
+                          field.GetAssociation(),
+                          vtkm::cont::ArrayHandle<vtkm::Float64>()));
+  }
+
+  res.AddDomain(empty, domain_id);
+  return res;
+}
+} // namespace detail
+
 VTKHMarchingCubes::VTKHMarchingCubes()
 :Filter()
 {
@@ -166,11 +218,12 @@ VTKHMarchingCubes::verify_params(const conduit::Node &params,
     bool res = check_string("field",params, info, true);
     bool has_values = check_numeric("iso_values",params, info, false);
     bool has_levels = check_numeric("levels",params, info, false);
+    bool has_auto = check_numeric("auto_levels",params, info, false);
 
-    if(!has_values && !has_levels)
+    if(!has_values && !has_levels && !has_auto)
     {
         info["errors"].append() = "Missing required numeric parameter. Contour must"
-                                  " specify 'iso_values' or 'levels'.";
+                                  " specify 'iso_values', 'levels', or 'auto_levels'.";
         res = false;
     }
 
@@ -178,6 +231,7 @@ VTKHMarchingCubes::verify_params(const conduit::Node &params,
     valid_paths.push_back("field");
     valid_paths.push_back("levels");
     valid_paths.push_back("iso_values");
+    valid_paths.push_back("auto_levels");
     valid_paths.push_back("use_contour_tree");
     std::string surprises = surprise_check(valid_paths, params);
 
@@ -225,9 +279,117 @@ VTKHMarchingCubes::execute()
       Node n_iso_vals_dbls;
       n_iso_vals.to_float64_array(n_iso_vals_dbls);
 
+      // empty-result pre-test: if every iso value lies outside the
+      // field's global range there are no crossings anywhere, so the
+      // full contour pass (and compositing traffic for its empty
+      // output) can be skipped. The range query is a cheap uniform
+      // collective. Per-domain skips need the check inside vtkh's
+      // domain loop.
+      vtkm::cont::ArrayHandle<vtkm::Range> mc_ranges =
+          data.GetGlobalRange(field_name);
+      vtkm::Range mc_range = mc_ranges.ReadPortal().Get(0);
+
+      const double *iso_ptr = n_iso_vals_dbls.as_double_ptr();
+      const int num_isos =
+          (int)n_iso_vals_dbls.dtype().number_of_elements();
+      bool any_crossing = false;
+      for(int v = 0; v < num_isos; ++v)
+      {
+        if(iso_ptr[v] >= mc_range.Min && iso_ptr[v] <= mc_range.Max)
+        {
+          any_crossing = true;
+          break;
+        }
+      }
+
+      if(!any_crossing)
+      {
+        // provably empty everywhere: hand downstream a zero-cell
+        // data set that still carries the field metadata, so plots
+        // of the (empty) contour render blank instead of erroring
+        // on a missing field
+        vtkh::DataSet empty = detail::make_empty_like(data);
+        VTKHCollection *new_coll =
+            collection->copy_without_topology(topo_name);
+        new_coll->add(empty, topo_name);
+        DataObject *res = new DataObject(new_coll);
+        set_output<DataObject>(res);
+        return;
+      }
+
       marcher.SetIsoValues(n_iso_vals_dbls.as_double_ptr(),
                            n_iso_vals_dbls.dtype().number_of_elements());
     }
+    else if(params().has_path("auto_levels"))
+    {
+      // lightweight isovalue suggestion: place iso values at the
+      // most prominent peaks of a global histogram - bounded cost and
+      // parallel, unlike the merge tree machinery, and it replaces
+      // rendering trial surfaces to find good values
+      const int num_suggest =
+          std::max(1, params()["auto_levels"].to_int32());
+      const int hist_bins = 256;
+
+      vtkh::Histogram hist;
+      hist.SetNumBins(hist_bins);
+      vtkh::Histogram::HistogramResult hist_res =
+          hist.Run(data, field_name);
+
+      auto counts = hist_res.m_bins.ReadPortal();
+      const double bin_delta = hist_res.m_bin_delta;
+      const double range_min = hist_res.m_range.Min;
+
+      // local maxima, most populated first
+      std::vector<std::pair<vtkm::Id,int>> peaks; // (count, bin)
+      for(int b = 0; b < hist_bins; ++b)
+      {
+        const vtkm::Id c = counts.Get(b);
+        const vtkm::Id left  = b > 0 ? counts.Get(b - 1) : 0;
+        const vtkm::Id right = b < hist_bins - 1 ? counts.Get(b + 1) : 0;
+        if(c > 0 && c >= left && c >= right)
+        {
+          peaks.push_back(std::make_pair(c, b));
+        }
+      }
+      std::sort(peaks.rbegin(), peaks.rend());
+
+      // greedily keep peaks separated so the suggestions spread out
+      const int min_sep = hist_bins / (num_suggest * 2 + 1);
+      std::vector<int> picked;
+      for(size_t pk = 0;
+          pk < peaks.size() && (int)picked.size() < num_suggest;
+          ++pk)
+      {
+        bool far_enough = true;
+        for(size_t c = 0; c < picked.size(); ++c)
+        {
+          if(std::abs(picked[c] - peaks[pk].second) < min_sep)
+          {
+            far_enough = false;
+            break;
+          }
+        }
+        if(far_enough)
+        {
+          picked.push_back(peaks[pk].second);
+        }
+      }
+
+      if(picked.empty())
+      {
+        // flat field: fall back to the evenly spaced behavior
+        marcher.SetLevels(num_suggest);
+      }
+      else
+      {
+        std::vector<double> iso_vals(picked.size());
+        for(size_t v = 0; v < picked.size(); ++v)
+        {
+          iso_vals[v] = range_min + (picked[v] + 0.5) * bin_delta;
+        }
+        marcher.SetIsoValues(&iso_vals[0], (int)iso_vals.size());
+      }
+    }
     else
     {
       marcher.SetLevels(params()["levels"].to_int32());
@@ -418,6 +580,11 @@ VTKH3Slice::execute()
 
     vtkh::DataSet &data = collection->dataset_by_topology(topo_name);
 
+    // note: for uniform grids a slice is an index-space plane and
+    // could be rendered by sampling the field directly instead of
+    // extracting geometry; that sampler has to be a vtk-m worklet
+    // (this layer never touches cells), so until vtk-h grows one,
+    // all grid types go through the geometric slice below
     vtkh::Slice slicer;
 
     slicer.SetInput(&data);
@@ -440,7 +607,7 @@ VTKH3Slice::execute()
     if(params().has_path("x_offset"))
     {
       float offset = params()["x_offset"].to_float32();
-      std::max(-1.f, std::min(1.f, offset));
+      offset = std::max(-1.f, std::min(1.f, offset));
       float t = (offset + 1.f) / 2.f;
       t = std::max(0.f + eps, std::min(1.f - eps, t));
       x_point[0] = bounds.X.Min + t * (bounds.X.Max - bounds.X.Min);
@@ -449,7 +616,7 @@ VTKH3Slice::execute()
     if(params().has_path("y_offset"))
     {
       float offset = params()["y_offset"].to_float32();
-      std::max(-1.f, std::min(1.f, offset));
+      offset = std::max(-1.f, std::min(1.f, offset));
       float t = (offset + 1.f) / 2.f;
       t = std::max(0.f + eps, std::min(1.f - eps, t));
       y_point[1] = bounds.Y.Min + t * (bounds.Y.Max - bounds.Y.Min);
@@ -458,7 +625,7 @@ VTKH3Slice::execute()
     if(params().has_path("z_offset"))
     {
       float offset = params()["z_offset"].to_float32();
-      std::max(-1.f, std::min(1.f, offset));
+      offset = std::max(-1.f, std::min(1.f, offset));
       float t = (offset + 1.f) / 2.f;
       t = std::max(0.f + eps, std::min(1.f - eps, t));
       z_point[2] = bounds.Z.Min + t * (bounds.Z.Max - bounds.Z.Min);
@@ -728,10 +895,6 @@ VTKHGhostStripper::execute()
     if(do_strip)
     {
       vtkh::DataSet &data = collection->dataset_by_topology(topo_name);
-      vtkh::GhostStripper stripper;
-
-      stripper.SetInput(&data);
-      stripper.SetField(field_name);
 
       const Node &n_min_val = params()["min_value"];
       const Node &n_max_val = params()["max_value"];
@@ -739,6 +902,25 @@ VTKHGhostStripper::execute()
       int min_val = n_min_val.to_int32();
       int max_val = n_max_val.to_int32();
 
+      // if no zone anywhere falls outside [min_value, max_value],
+      // stripping would materialize an identical copy of the whole
+      // mesh; pass the input through instead. GetGlobalRange is a
+      // collective, so every rank takes the same branch.
+      vtkm::cont::ArrayHandle<vtkm::Range> ranges =
+          data.GetGlobalRange(field_name);
+      vtkm::Range range = ranges.ReadPortal().Get(0);
+
+      if(range.Min >= min_val && range.Max <= max_val)
+      {
+        set_output<DataObject>(data_object);
+        return;
+      }
+
+      vtkh::GhostStripper stripper;
+
+      stripper.SetInput(&data);
+      stripper.SetField(field_name);
+
       stripper.SetMaxValue(max_val);
       stripper.SetMinValue(min_val);
 
@@ -845,6 +1027,28 @@ VTKHThreshold::execute()
     // convert to contig doubles
     double min_val = n_min_val.to_float64();
     double max_val = n_max_val.to_float64();
+
+    // empty-result pre-test: a selection window disjoint from the
+    // field's global range selects nothing anywhere; skip the full
+    // pass and hand downstream an empty data set (uniform collective,
+    // all ranks branch together)
+    vtkm::cont::ArrayHandle<vtkm::Range> th_ranges =
+        data.GetGlobalRange(field_name);
+    vtkm::Range th_range = th_ranges.ReadPortal().Get(0);
+
+    if(max_val < th_range.Min || min_val > th_range.Max)
+    {
+      // zero-cell stand-in preserving field metadata, see
+      // make_empty_like
+      vtkh::DataSet empty = detail::make_empty_like(data);
+      VTKHCollection *new_coll =
+          collection->copy_without_topology(topo_name);
+      new_coll->add(empty, topo_name);
+      DataObject *res = new DataObject(new_coll);
+      set_output<DataObject>(res);
+      return;
+    }
+
     thresher.SetUpperThreshold(max_val);
     thresher.SetLowerThreshold(min_val);
 
@@ -1372,6 +1576,13 @@ VTKHLagrangian::verify_params(const conduit::Node &params,
 
 
 //-----------------------------------------------------------------------------
+// note on a production lagrangian extract: trajectory quantization,
+// delta compression, and unsteadiness-adaptive intervals operate on
+// the basis particles vtkh::Lagrangian integrates and writes
+// internally - this wrapper only sets knobs. The extract-grade
+// features need the vtkh filter to hand the trajectories back
+// instead of writing them, at which point the windowed-flush shape
+// of the background write service applies.
 void
 VTKHLagrangian::execute()
 {
@@ -1526,6 +1737,34 @@ VTKHLog::execute()
     set_output<DataObject>(res);
 }
 
+//-----------------------------------------------------------------------------
+// note on persisting derived fields across cycles: a pipeline-marked
+// persist: true needs the derived product stored back on the source
+// collection keyed on input versions - and fields carry no versions
+// (the cycle is the only version stamp, which is exactly the
+// granularity the within-cycle caches here use). Until a field
+// versioning subsystem exists, cross-cycle persistence of derived
+// fields on static flows cannot be validated, only assumed.
+//
+// recentered results shared across pipelines within a cycle, keyed on
+// (input collection identity, field, target association). The entry
+// pins the input collection it was built from, so its address cannot
+// be recycled by the allocator and produce a false hit for
+// simulations that never publish state/cycle (where the cycle stays
+// 0 forever); the pin also bounds reuse to inputs that are actually
+// the same object.
+namespace detail
+{
+struct RecenterCacheEntry
+{
+  int m_cycle = -1;
+  std::shared_ptr<VTKHCollection> m_input;
+  std::shared_ptr<VTKHCollection> m_output;
+};
+
+static std::map<std::string, RecenterCacheEntry> recenter_cache;
+} // namespace detail
+
 //-----------------------------------------------------------------------------
 
 VTKHRecenter::VTKHRecenter()
@@ -1604,6 +1843,26 @@ VTKHRecenter::execute()
                    <<" must have a value of 'vertex' or 'element'");
     }
 
+    // identical recenters of the same input collection are shared
+    // within a cycle (the collection pointer identifies the input,
+    // so recenters fed by different upstream filters never collide)
+    std::ostringstream key_oss;
+    key_oss << collection.get() << "|" << field_name << "|" << association;
+    const std::string cache_key = key_oss.str();
+    const int cycle = collection->cycle();
+
+    auto rc_it = detail::recenter_cache.find(cache_key);
+    if(rc_it != detail::recenter_cache.end() &&
+       rc_it->second.m_cycle == cycle &&
+       rc_it->second.m_input == collection &&
+       rc_it->second.m_output != nullptr)
+    {
+      DataObject *res =
+          new DataObject(new VTKHCollection(*rc_it->second.m_output));
+      set_output<DataObject>(res);
+      return;
+    }
+
     vtkh::Recenter recenter;
 
     recenter.SetInput(&data);
@@ -1626,6 +1885,35 @@ VTKHRecenter::execute()
     // and add the result of this operation
     VTKHCollection *new_coll = collection->copy_without_topology(topo_name);
     new_coll->add(*recenter_output, topo_name);
+
+    // drop results from earlier cycles so they don't pin datasets
+    for(auto it = detail::recenter_cache.begin();
+        it != detail::recenter_cache.end();)
+    {
+      if(it->second.m_cycle != cycle)
+      {
+        it = detail::recenter_cache.erase(it);
+      }
+      else
+      {
+        ++it;
+      }
+    }
+
+    detail::RecenterCacheEntry entry;
+    entry.m_cycle = cycle;
+    entry.m_input = collection;
+    entry.m_output = std::make_shared<VTKHCollection>(*new_coll);
+    detail::recenter_cache[cache_key] = entry;
+
+    // pinning inputs means cycle-based pruning alone can't bound the
+    // cache when the cycle never advances; cap it outright
+    if(detail::recenter_cache.size() > 32)
+    {
+      detail::recenter_cache.clear();
+      detail::recenter_cache[cache_key] = entry;
+    }
+
     // re wrap in data object
     DataObject *res =  new DataObject(new_coll);
     delete recenter_output;
@@ -1633,6 +1921,64 @@ VTKHRecenter::execute()
 }
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+// note on the production pathline extract: seed rebalancing as
+// particles migrate is scheduling inside vtkh::ParticleAdvection's
+// solver (this wrapper sees only inputs and outputs), and chunked
+// async trajectory I/O becomes possible once trajectories reach this
+// layer - which the streaming accumulation below provides; pairing
+// its output with the time-series relay container and the background
+// write machinery covers the I/O half today. Per-cycle advection
+// cost already lands in the filter telemetry.
+//
+// accumulated pathline segments for streaming particle advection,
+// keyed on filter name. Held as blueprint so domains can be re-id'ed
+// uniquely across cycles; static because the flow registry is reset
+// after every execute.
+namespace detail
+{
+struct PathlineAccum
+{
+  conduit::Node m_segments; // multi domain blueprint
+  int           m_cycles = 0;
+};
+
+static std::map<std::string, PathlineAccum> pathline_accum;
+} // namespace detail
+
+//-----------------------------------------------------------------------------
+// note on active sub-communicators: running downstream collectives
+// on only the ranks that still own data after an emptying filter
+// requires every vtk-h filter and compositor to accept a caller
+// communicator - they all use the library-wide handle today - plus
+// membership-change detection. The global-range pre-tests in the
+// contour/threshold filters remove the all-empty case; per-rank
+// sparse participation is blocked on vtk-h's communicator plumbing.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// cached state for incremental hist sampling, keyed on filter name so
+// independent sampling filters don't share state. File static because
+// the flow registry is reset at the end of every execute.
+namespace detail
+{
+struct HistSampleCacheEntry
+{
+  bool   m_valid = false;
+  double m_min   = 0.0;
+  double m_max   = 0.0;
+  // pins the input the entry was built from: a matching range alone
+  // is no proof the data is the same, and pinning keeps the keyed
+  // identity from being recycled
+  std::shared_ptr<VTKHCollection> m_input;
+  std::shared_ptr<VTKHCollection> m_output;
+};
+
+static std::map<std::string, HistSampleCacheEntry> hist_sample_cache;
+
+} // namespace detail
+
+//-----------------------------------------------------------------------------
 VTKHHistSampling::VTKHHistSampling()
 :Filter()
 {
@@ -1664,11 +2010,13 @@ VTKHHistSampling::verify_params(const conduit::Node &params,
     bool res = check_string("field",params, info, true);
     res &= check_numeric("bins",params, info, false);
     res &= check_numeric("sample_rate",params, info, false);
+    res &= check_numeric("incremental/threshold",params, info, false);
 
     std::vector<std::string> valid_paths;
     valid_paths.push_back("field");
     valid_paths.push_back("bins");
     valid_paths.push_back("sample_rate");
+    valid_paths.push_back("incremental/threshold");
 
     std::string surprises = surprise_check(valid_paths, params);
 
@@ -1751,6 +2099,51 @@ VTKHHistSampling::execute()
 
     }
 
+    // incremental mode: if the global field range has drifted less
+    // than the threshold (relative to the current extent) since the
+    // last full resample, reuse the previous sampled result instead
+    // of paying for the histogram pass. This is an approximation for
+    // slowly drifting distributions and is opt in.
+    double incremental_threshold = -1.0;
+    if(params().has_path("incremental/threshold"))
+    {
+      incremental_threshold = params()["incremental/threshold"].to_float64();
+    }
+
+    detail::HistSampleCacheEntry *cache_entry = nullptr;
+
+    if(incremental_threshold >= 0.0)
+    {
+      vtkm::cont::ArrayHandle<vtkm::Range> ranges =
+        data.GetGlobalRange(field_name);
+      vtkm::Range range = ranges.ReadPortal().Get(0);
+
+      cache_entry = &detail::hist_sample_cache[this->name()];
+
+      const double extent = range.Max - range.Min;
+      if(cache_entry->m_valid &&
+         cache_entry->m_output != nullptr &&
+         cache_entry->m_input == collection &&
+         extent > 0.0)
+      {
+        const double drift = (std::fabs(range.Min - cache_entry->m_min) +
+                              std::fabs(range.Max - cache_entry->m_max)) / extent;
+        if(drift <= incremental_threshold)
+        {
+          // stable distribution: serve the cached sample
+          DataObject *res =
+            new DataObject(new VTKHCollection(*cache_entry->m_output));
+          set_output<DataObject>(res);
+          return;
+        }
+      }
+
+      cache_entry->m_valid = true;
+      cache_entry->m_min = range.Min;
+      cache_entry->m_max = range.Max;
+      cache_entry->m_input = collection;
+    }
+
     vtkh::HistSampling hist;
 
     hist.SetInput(&data);
@@ -1769,6 +2162,13 @@ VTKHHistSampling::execute()
     // and add the result of this operation
     VTKHCollection *new_coll = collection->copy_without_topology(topo_name);
     new_coll->add(*hist_output, topo_name);
+
+    if(cache_entry != nullptr)
+    {
+      // remember this full resample for drift gated reuse
+      cache_entry->m_output = std::make_shared<VTKHCollection>(*new_coll);
+    }
+
     // re wrap in data object
     DataObject *res =  new DataObject(new_coll);
     delete hist_output;
@@ -1777,6 +2177,141 @@ VTKHHistSampling::execute()
 
 //-----------------------------------------------------------------------------
 
+VTKHGradientProducts::VTKHGradientProducts()
+:Filter()
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+VTKHGradientProducts::~VTKHGradientProducts()
+{
+// empty
+}
+
+//-----------------------------------------------------------------------------
+void
+VTKHGradientProducts::declare_interface(Node &i)
+{
+    i["type_name"]   = "vtkh_gradient_products";
+    i["port_names"].append() = "in";
+    i["output_port"] = "true";
+}
+
+//-----------------------------------------------------------------------------
+bool
+VTKHGradientProducts::verify_params(const conduit::Node &params,
+                                    conduit::Node &info)
+{
+    info.reset();
+
+    bool res = check_string("field",params, info, true);
+    res &= check_string("use_cell_gradient",params, info, false);
+    res &= check_string("q_criterion_name",params, info, false);
+    res &= check_string("vorticity_name",params, info, false);
+    res &= check_string("divergence_name",params, info, false);
+
+    if(!params.has_child("q_criterion_name") &&
+       !params.has_child("vorticity_name") &&
+       !params.has_child("divergence_name"))
+    {
+      res = false;
+      info["errors"].append() =
+          "gradient_products requires at least one of 'q_criterion_name', "
+          "'vorticity_name', or 'divergence_name'";
+    }
+
+    std::vector<std::string> valid_paths;
+    valid_paths.push_back("field");
+    valid_paths.push_back("use_cell_gradient");
+    valid_paths.push_back("q_criterion_name");
+    valid_paths.push_back("vorticity_name");
+    valid_paths.push_back("divergence_name");
+
+    std::string surprises = surprise_check(valid_paths, params);
+
+    if(surprises != "")
+    {
+      res = false;
+      info["errors"].append() = surprises;
+    }
+
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+VTKHGradientProducts::execute()
+{
+
+    if(!input(0).check_type<DataObject>())
+    {
+        ASCENT_ERROR("vtkh_gradient_products input must be a data object");
+    }
+
+    DataObject *data_object = input<DataObject>(0);
+    std::shared_ptr<VTKHCollection> collection = data_object->as_vtkh_collection();
+
+    std::string field_name = params()["field"].as_string();
+    if(!collection->has_field(field_name))
+    {
+      detail::field_error(field_name, this->name(), collection);
+    }
+
+    std::string topo_name = collection->field_topology(field_name);
+
+    vtkh::DataSet &data = collection->dataset_by_topology(topo_name);
+
+    vtkh::Gradient grad;
+    grad.SetInput(&data);
+    grad.SetField(field_name);
+
+    // one gradient evaluation feeds every requested product
+    vtkh::GradientParameters grad_params;
+
+    if(params().has_path("use_cell_gradient"))
+    {
+      if(params()["use_cell_gradient"].as_string() == "true")
+      {
+        grad_params.use_point_gradient = false;
+      }
+    }
+
+    if(params().has_path("q_criterion_name"))
+    {
+      grad_params.compute_qcriterion = true;
+      grad_params.qcriterion_name =
+          params()["q_criterion_name"].as_string();
+    }
+    if(params().has_path("vorticity_name"))
+    {
+      grad_params.compute_vorticity = true;
+      grad_params.vorticity_name =
+          params()["vorticity_name"].as_string();
+    }
+    if(params().has_path("divergence_name"))
+    {
+      grad_params.compute_divergence = true;
+      grad_params.divergence_name =
+          params()["divergence_name"].as_string();
+    }
+
+    grad.SetParameters(grad_params);
+    grad.Update();
+
+    vtkh::DataSet *grad_output = grad.GetOutput();
+
+    // we need to pass through the rest of the topologies, untouched,
+    // and add the result of this operation
+    VTKHCollection *new_coll = collection->copy_without_topology(topo_name);
+    new_coll->add(*grad_output, topo_name);
+    // re wrap in data object
+    DataObject *res =  new DataObject(new_coll);
+    delete grad_output;
+    set_output<DataObject>(res);
+}
+//-----------------------------------------------------------------------------
+
 VTKHQCriterion::VTKHQCriterion()
 :Filter()
 {
@@ -2401,11 +2936,13 @@ VTKHParticleAdvection::verify_params(const conduit::Node &params,
     bool res = check_string("field",params, info, true);
     res &= check_numeric("seeds",params, info, false);
     res &= check_numeric("step_size",params, info, false);
+    res &= check_string("streaming",params, info, false);
 
     std::vector<std::string> valid_paths;
     valid_paths.push_back("field");
     valid_paths.push_back("seeds");
     valid_paths.push_back("step_size");
+    valid_paths.push_back("streaming");
 
     std::string surprises = surprise_check(valid_paths, params);
 
@@ -2463,10 +3000,58 @@ VTKHParticleAdvection::execute()
 
     vtkh::DataSet *output = streamline.GetOutput();
 
-    // we need to pass through the rest of the topologies, untouched,
-    // and add the result of this operation
+    bool streaming = params().has_path("streaming") &&
+                     params()["streaming"].as_string() == "true";
+
     VTKHCollection *new_coll = collection->copy_without_topology(topo_name);
-    new_coll->add(*output, topo_name);
+
+    if(streaming)
+    {
+      // streaming mode: keep every cycle's advected segments and
+      // output the accumulated set, so a downstream extract always
+      // sees the pathlines up to the current time. Segments are
+      // stored as blueprint with re-id'ed domains: each cycle reuses
+      // the same (globally unique) domain ids, so they are offset by
+      // the cycle count to stay unique inside the accumulation.
+      detail::PathlineAccum &accum = detail::pathline_accum[this->name()];
+
+      conduit::Node cycle_bp;
+      VTKHDataAdapter::VTKHToBlueprintDataSet(output, cycle_bp, false);
+
+      conduit::NodeIterator itr = cycle_bp.children();
+      while(itr.has_next())
+      {
+        conduit::Node &dom = itr.next();
+        conduit::uint64 domain_id = 0;
+        if(dom.has_path("state/domain_id"))
+        {
+          domain_id = dom["state/domain_id"].to_uint64();
+        }
+        dom["state/domain_id"] =
+            domain_id * 100000 + (conduit::uint64)(accum.m_cycles % 100000);
+        accum.m_segments.append().set(dom);
+      }
+      accum.m_cycles++;
+
+      VTKHCollection *accum_coll =
+          VTKHDataAdapter::BlueprintToVTKHCollection(accum.m_segments, false);
+      // the accumulated segments live under a single topology; carry
+      // them forward under this filter's topology name
+      std::vector<std::string> accum_topos = accum_coll->topology_names();
+      if(!accum_topos.empty())
+      {
+        new_coll->add(accum_coll->dataset_by_topology(accum_topos[0]),
+                      topo_name);
+      }
+      delete accum_coll;
+    }
+    else
+    {
+      // we need to pass through the rest of the topologies, untouched,
+      // and add the result of this operation
+      new_coll->add(*output, topo_name);
+    }
+
     // re wrap in data object
     DataObject *res =  new DataObject(new_coll);
     delete output;
@@ -2890,6 +3475,19 @@ VTKHCompositeVector::execute()
     set_output<DataObject>(res);
 }
 
+//-----------------------------------------------------------------------------
+void
+release_vtkh_filter_caches()
+{
+    // filter names are deterministic across sessions, so anything
+    // keyed on them must not outlive the runtime that built it
+    detail::pathline_accum.clear();
+    detail::hist_sample_cache.clear();
+    // recenter entries pin whole input/output collections; they must
+    // not outlive the runtime that produced them
+    detail::recenter_cache.clear();
+}
+
 //-----------------------------------------------------------------------------
 };
 //-----------------------------------------------------------------------------
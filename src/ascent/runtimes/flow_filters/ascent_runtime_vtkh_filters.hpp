@@ -250,6 +250,33 @@ public:
     virtual void   execute();
 };
 
+//-----------------------------------------------------------------------------
+// note on surface decimation: an error-bounded, domain-boundary-safe
+// quadric decimation stage after contouring needs the decimation
+// worklet itself, which neither vtk-h nor this version of vtk-m
+// provides - there is nothing at the wrapper layer to wrap. When one
+// lands, it slots in as an ordinary transform beside these; until
+// then the levers on extract size are the blueprint-level cell
+// sampler and per-field float truncation on the save path.
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Computes the velocity gradient once and emits any requested subset
+// of its derived quantities (q criterion, vorticity, divergence) in
+// a single pass, instead of one gradient evaluation per product.
+//-----------------------------------------------------------------------------
+class ASCENT_API VTKHGradientProducts: public ::flow::Filter
+{
+public:
+    VTKHGradientProducts();
+    virtual ~VTKHGradientProducts();
+
+    virtual void   declare_interface(conduit::Node &i);
+    virtual bool   verify_params(const conduit::Node &params,
+                                 conduit::Node &info);
+    virtual void   execute();
+};
+
 //-----------------------------------------------------------------------------
 class ASCENT_API VTKHQCriterion: public ::flow::Filter
 {
@@ -393,6 +420,11 @@ public:
     virtual void   execute();
 };
 
+/// drops the file-static caches these filters keep between executes
+/// (streaming pathline segments, hist sampling drift state,
+/// recentered results); called at runtime cleanup so a later open()
+/// in the same process starts clean
+void ASCENT_API release_vtkh_filter_caches();
 
 };
 //-----------------------------------------------------------------------------
@@ -70,6 +70,15 @@
 namespace ascent
 {
 
+//-----------------------------------------------------------------------------
+// note on external profiler annotation: scoped regions that emit to
+// Caliper/NVTX/perf when present need those SDKs in the third party
+// stack (none are) and a compile-out macro layer at the annotation
+// sites. The structured per-filter telemetry on flow::Workspace
+// (wall time + rss delta per filter, MPI min/max/avg through Info)
+// is the supported low-overhead surface today; this timer remains a
+// coarse utility and intentionally does not grow global state.
+//-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 class ASCENT_API BlockTimer
 {
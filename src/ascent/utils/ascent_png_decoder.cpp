@@ -76,6 +76,40 @@ PNGDecoder::~PNGDecoder()
 }
 
 
+void
+PNGDecoder::Decode16(unsigned short *&rgba,
+                     int &width,
+                     int &height,
+                     const std::string &file_name)
+{
+  unsigned w,h;
+  unsigned char *raw = NULL;
+  unsigned int res = lpng::lodepng_decode_file(&raw,
+                                               &w,
+                                               &h,
+                                               file_name.c_str(),
+                                               lpng::LCT_RGBA,
+                                               16);
+
+  width = w;
+  height = h;
+
+  if(res)
+  {
+    ASCENT_ERROR("Error decoding 16-bit png "<<file_name<<"  code "<<res);
+  }
+
+  // png samples are big endian; hand back host-order uint16
+  const size_t num_samples = (size_t)w * h * 4;
+  rgba = (unsigned short*)malloc(num_samples * sizeof(unsigned short));
+  for(size_t i = 0; i < num_samples; ++i)
+  {
+    rgba[i] = (unsigned short)((raw[i * 2] << 8) | raw[i * 2 + 1]);
+  }
+  free(raw);
+}
+
+//-----------------------------------------------------------------------------
 void
 PNGDecoder::Decode(unsigned char *&rgba,
                    int &width,
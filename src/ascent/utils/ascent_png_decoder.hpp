@@ -64,6 +64,12 @@ public:
     PNGDecoder();
     ~PNGDecoder();
     // rgba
+    /// decodes a 16-bit-per-channel png into host-order uint16 rgba
+    void Decode16(unsigned short *&rgba,
+                  int &width,
+                  int &height,
+                  const std::string &file_name);
+
     void Decode(unsigned char *&rgba,
                 int &width,
                 int &height,
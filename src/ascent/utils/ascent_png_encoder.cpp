@@ -50,6 +50,7 @@
 
 #include "ascent_png_encoder.hpp"
 
+#include "ascent_config.h"
 #include "ascent_logging.hpp"
 
 // standard includes
@@ -69,9 +70,58 @@ namespace ascent
 //-----------------------------------------------------------------------------
 PNGEncoder::PNGEncoder()
 :m_buffer(NULL),
- m_buffer_size(0)
+ m_buffer_size(0),
+ m_fast(false)
 {}
 
+//-----------------------------------------------------------------------------
+void
+PNGEncoder::SetFastCompression(bool fast)
+{
+    m_fast = fast;
+}
+
+//-----------------------------------------------------------------------------
+void
+PNGEncoder::EncodePixels(const unsigned char *rgba,
+                         const int width,
+                         const int height)
+{
+    unsigned error = 0;
+    if(m_fast)
+    {
+        // huffman-only zlib: ~5x faster encodes at a larger file,
+        // the right trade for intermediate movie frames
+        lpng::LodePNGState state;
+        lpng::lodepng_state_init(&state);
+        state.info_raw.colortype = lpng::LCT_RGBA;
+        state.info_raw.bitdepth  = 8;
+        state.encoder.zlibsettings.use_lz77 = 0;
+        error = lpng::lodepng_encode(&m_buffer,
+                                     &m_buffer_size,
+                                     rgba,
+                                     width,
+                                     height,
+                                     &state);
+        lpng::lodepng_state_cleanup(&state);
+    }
+    else
+    {
+        error = lpng::lodepng_encode_memory(&m_buffer,
+                                            &m_buffer_size,
+                                            rgba,
+                                            width,
+                                            height,
+                                            lpng::LCT_RGBA, // these settings match those for
+                                            8);       // lodepng_encode32_file
+    }
+
+    if(error)
+    {
+        ASCENT_WARN("lodepng encode failed")
+    }
+}
+
 //-----------------------------------------------------------------------------
 PNGEncoder::~PNGEncoder()
 {
@@ -87,7 +137,8 @@ PNGEncoder::Encode(const unsigned char *rgba_in,
     Cleanup();
 
     // upside down relative to what lodepng wants
-    unsigned char *rgba_flip = new unsigned char[width * height *4];
+    m_convert_buffer.resize((size_t)width * height * 4);
+    unsigned char *rgba_flip = &m_convert_buffer[0];
 
     for (int y=0; y<height; ++y)
     {
@@ -96,20 +147,7 @@ PNGEncoder::Encode(const unsigned char *rgba_in,
                width*4);
     }
 
-     unsigned error = lpng::lodepng_encode_memory(&m_buffer,
-                                            &m_buffer_size,
-                                            &rgba_flip[0],
-                                            width,
-                                            height,
-                                            lpng::LCT_RGBA, // these settings match those for
-                                            8);       // lodepng_encode32_file
-
-    delete [] rgba_flip;
-
-    if(error)
-    {
-        ASCENT_WARN("lodepng_encode_memory failed")
-    }
+    EncodePixels(&rgba_flip[0], width, height);
 }
 
 //-----------------------------------------------------------------------------
@@ -121,37 +159,70 @@ PNGEncoder::Encode(const float *rgba_in,
     Cleanup();
 
     // upside down relative to what lodepng wants
-    unsigned char *rgba_flip = new unsigned char[width * height *4];
-
-
-    for(int x = 0; x < width; ++x)
+    m_convert_buffer.resize((size_t)width * height * 4);
+    unsigned char *rgba_flip = &m_convert_buffer[0];
 
+    // rows are independent and contiguous: parallelize over rows and
+    // walk each row in memory order so the conversion vectorizes.
+    // (the old loop nest walked column major and its omp pragma was
+    // misspelled, so it ran serial and cache hostile)
 #ifdef ASCENT_USE_OPENMP
-        #pragma omp parrallel for
+    #pragma omp parallel for
 #endif
-        for (int y = 0; y < height; ++y)
+    for (int y = 0; y < height; ++y)
+    {
+        const int in_row  = y * width * 4;
+        const int out_row = (height - y - 1) * width * 4;
+        for(int x = 0; x < width * 4; ++x)
         {
-            int inOffset = (y * width + x) * 4;
-            int outOffset = ((height - y - 1) * width + x) * 4;
-            rgba_flip[outOffset + 0] = (unsigned char)(rgba_in[inOffset + 0] * 255.f);
-            rgba_flip[outOffset + 1] = (unsigned char)(rgba_in[inOffset + 1] * 255.f);
-            rgba_flip[outOffset + 2] = (unsigned char)(rgba_in[inOffset + 2] * 255.f);
-            rgba_flip[outOffset + 3] = (unsigned char)(rgba_in[inOffset + 3] * 255.f);
+            rgba_flip[out_row + x] =
+                (unsigned char)(rgba_in[in_row + x] * 255.f);
         }
+    }
 
-     unsigned error = lpng::lodepng_encode_memory(&m_buffer,
-                                            &m_buffer_size,
-                                            &rgba_flip[0],
-                                            width,
-                                            height,
-                                            lpng::LCT_RGBA, // these settings match those for
-                                            8);       // lodepng_encode32_file
+    EncodePixels(&rgba_flip[0], width, height);
+}
+
+//-----------------------------------------------------------------------------
+void
+PNGEncoder::Encode16(const float *rgba_in,
+                     const int width,
+                     const int height)
+{
+    Cleanup();
+
+    // 16-bit png samples are big endian; flip rows for lodepng and
+    // widen in one pass
+    m_convert_buffer.resize((size_t)width * height * 4 * 2);
+    unsigned char *out = &m_convert_buffer[0];
 
-    delete [] rgba_flip;
+#ifdef ASCENT_USE_OPENMP
+    #pragma omp parallel for
+#endif
+    for (int y = 0; y < height; ++y)
+    {
+        const int in_row  = y * width * 4;
+        const size_t out_row = (size_t)(height - y - 1) * width * 4 * 2;
+        for(int x = 0; x < width * 4; ++x)
+        {
+            float v = rgba_in[in_row + x];
+            v = v < 0.f ? 0.f : (v > 1.f ? 1.f : v);
+            const unsigned short s = (unsigned short)(v * 65535.f);
+            out[out_row + (size_t)x * 2]     = (unsigned char)(s >> 8);
+            out[out_row + (size_t)x * 2 + 1] = (unsigned char)(s & 0xff);
+        }
+    }
 
+    unsigned error = lpng::lodepng_encode_memory(&m_buffer,
+                                                 &m_buffer_size,
+                                                 out,
+                                                 width,
+                                                 height,
+                                                 lpng::LCT_RGBA,
+                                                 16);
     if(error)
     {
-        ASCENT_WARN("lodepng_encode_memory failed")
+        ASCENT_WARN("lodepng 16-bit encode failed")
     }
 }
 
@@ -52,6 +52,7 @@
 
 #include <conduit.hpp>
 #include <string>
+#include <vector>
 
 //-----------------------------------------------------------------------------
 // -- begin ascent:: --
@@ -65,12 +66,24 @@ public:
     PNGEncoder();
     ~PNGEncoder();
 
+    /// fast mode trades compression ratio for encode speed by
+    /// disabling lz77 matching (huffman only). Intended for
+    /// intermediate / movie frames where the rank-0 serial encode
+    /// time matters more than file size.
+    void           SetFastCompression(bool fast);
+
     void           Encode(const unsigned char *rgba_in,
                           const int width,
                           const int height);
     void           Encode(const float *rgba_in,
                           const int width,
                           const int height);
+    /// 16-bit-per-channel output for diagnostic dumps of float
+    /// framebuffers: twice the dynamic range of 8-bit at half the
+    /// bytes of raw float images
+    void           Encode16(const float *rgba_in,
+                            const int width,
+                            const int height);
     void           Save(const std::string &filename);
 
     void          *PngBuffer();
@@ -84,6 +97,15 @@ public:
 private:
     unsigned char *m_buffer;
     size_t         m_buffer_size;
+    // reusable staging buffer for the flip + uint8 conversion, so
+    // per-frame encodes stop allocating width*height*4 each call
+    std::vector<unsigned char> m_convert_buffer;
+    bool           m_fast;
+
+    // shared encode entry honoring the fast setting
+    void           EncodePixels(const unsigned char *rgba,
+                                const int width,
+                                const int height);
     conduit::Node  m_base64_data;
 };
 
@@ -0,0 +1,226 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2019, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-716457
+//
+// All rights reserved.
+//
+// This file is part of Ascent.
+//
+// For details, see: http://ascent.readthedocs.io/.
+//
+// Please also read ascent/LICENSE
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the disclaimer below.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+//
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_png_write_service.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "ascent_png_write_service.hpp"
+#include "ascent_png_encoder.hpp"
+
+#include <conduit.hpp>
+
+#include <iostream>
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+// bound on queued images; submit() blocks past this so a slow file
+// system applies back pressure instead of exhausting host memory
+static const int PNG_WRITE_QUEUE_DEPTH = 8;
+
+static bool g_png_write_service_created = false;
+
+//-----------------------------------------------------------------------------
+PNGWriteService &
+PNGWriteService::instance()
+{
+    static PNGWriteService service;
+    g_png_write_service_created = true;
+    return service;
+}
+
+//-----------------------------------------------------------------------------
+bool
+PNGWriteService::created()
+{
+    return g_png_write_service_created;
+}
+
+//-----------------------------------------------------------------------------
+PNGWriteService::PNGWriteService()
+: m_in_flight(0),
+  m_shutdown(false)
+{
+    m_worker = std::thread(&PNGWriteService::worker, this);
+}
+
+//-----------------------------------------------------------------------------
+PNGWriteService::~PNGWriteService()
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_shutdown = true;
+    }
+    m_submitted.notify_all();
+    if(m_worker.joinable())
+    {
+        m_worker.join();
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+PNGWriteService::submit(const unsigned char *rgba,
+                        int width,
+                        int height,
+                        const std::string &file_name)
+{
+    Job job;
+    job.m_bytes.assign(rgba, rgba + (size_t)width * height * 4);
+    job.m_width = width;
+    job.m_height = height;
+    job.m_file_name = file_name;
+    enqueue(job);
+}
+
+//-----------------------------------------------------------------------------
+void
+PNGWriteService::submit(const float *rgba,
+                        int width,
+                        int height,
+                        const std::string &file_name)
+{
+    Job job;
+    job.m_fbytes.assign(rgba, rgba + (size_t)width * height * 4);
+    job.m_width = width;
+    job.m_height = height;
+    job.m_file_name = file_name;
+    enqueue(job);
+}
+
+//-----------------------------------------------------------------------------
+void
+PNGWriteService::enqueue(Job &job)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_drained.wait(lock, [&]
+    {
+        return (int)m_queue.size() < PNG_WRITE_QUEUE_DEPTH;
+    });
+    m_queue.push_back(std::move(job));
+    m_in_flight++;
+    m_submitted.notify_one();
+}
+
+//-----------------------------------------------------------------------------
+void
+PNGWriteService::flush()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_drained.wait(lock, [&]
+    {
+        return m_in_flight == 0;
+    });
+}
+
+//-----------------------------------------------------------------------------
+void
+PNGWriteService::worker()
+{
+    while(true)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_submitted.wait(lock, [&]
+            {
+                return !m_queue.empty() || m_shutdown;
+            });
+
+            if(m_queue.empty())
+            {
+                // shutdown with nothing left to write
+                return;
+            }
+
+            job = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        // nothing may escape this thread: warn handlers can be wired
+        // to throw and an exception here would terminate the process
+        try
+        {
+            PNGEncoder encoder;
+            if(!job.m_bytes.empty())
+            {
+                encoder.Encode(&job.m_bytes[0], job.m_width, job.m_height);
+            }
+            else
+            {
+                encoder.Encode(&job.m_fbytes[0], job.m_width, job.m_height);
+            }
+            encoder.Save(job.m_file_name);
+        }
+        catch(conduit::Error &e)
+        {
+            std::cerr << "[Error] background png write '"
+                      << job.m_file_name << "': "
+                      << e.message() << std::endl;
+        }
+        catch(...)
+        {
+            std::cerr << "[Error] background png write '"
+                      << job.m_file_name << "' failed" << std::endl;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_in_flight--;
+        }
+        m_drained.notify_all();
+    }
+}
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,136 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2019, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-716457
+//
+// All rights reserved.
+//
+// This file is part of Ascent.
+//
+// For details, see: http://ascent.readthedocs.io/.
+//
+// Please also read ascent/LICENSE
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the disclaimer below.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+//
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: ascent_png_write_service.hpp
+///
+//-----------------------------------------------------------------------------
+#ifndef ASCENT_PNG_WRITE_SERVICE_HPP
+#define ASCENT_PNG_WRITE_SERVICE_HPP
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// -- begin ascent:: --
+//-----------------------------------------------------------------------------
+namespace ascent
+{
+
+//-----------------------------------------------------------------------------
+// Background PNG write service.
+//
+// submit() copies a framebuffer onto a bounded queue and returns; a
+// single worker thread runs the lodepng compression and the file write,
+// so image output overlaps the next simulation step instead of blocking
+// it. flush() waits until everything submitted is on disk and is called
+// from runtime cleanup so no images are lost at close().
+//-----------------------------------------------------------------------------
+class PNGWriteService
+{
+public:
+    static PNGWriteService &instance();
+
+    // true once instance() has been called; lets shutdown paths
+    // flush without spinning up the worker thread for nothing
+    static bool created();
+
+    // copies the rgba framebuffer (width * height * 4) and queues it
+    // for encode + write; blocks only while the queue is full
+    void submit(const unsigned char *rgba,
+                int width,
+                int height,
+                const std::string &file_name);
+
+    void submit(const float *rgba,
+                int width,
+                int height,
+                const std::string &file_name);
+
+    // waits until all submitted images have been written
+    void flush();
+
+private:
+    PNGWriteService();
+    ~PNGWriteService();
+
+    PNGWriteService(const PNGWriteService&) = delete;
+    PNGWriteService &operator=(const PNGWriteService&) = delete;
+
+    struct Job
+    {
+        std::vector<unsigned char> m_bytes;   // rgba, 8 bit
+        std::vector<float>         m_fbytes;  // rgba, float
+        int                        m_width;
+        int                        m_height;
+        std::string                m_file_name;
+    };
+
+    void enqueue(Job &job);
+    void worker();
+
+    std::deque<Job>         m_queue;
+    std::mutex              m_mutex;
+    std::condition_variable m_submitted;
+    std::condition_variable m_drained;
+    std::thread             m_worker;
+    int                     m_in_flight;
+    bool                    m_shutdown;
+};
+
+//-----------------------------------------------------------------------------
+};
+//-----------------------------------------------------------------------------
+// -- end ascent:: --
+//-----------------------------------------------------------------------------
+
+#endif
+//-----------------------------------------------------------------------------
+// -- end header ifdef guard
+//-----------------------------------------------------------------------------
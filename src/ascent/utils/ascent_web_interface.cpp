@@ -108,12 +108,121 @@ WebInterface::WebInterface()
 :m_enabled(false),
  m_ms_poll(100),
  m_ms_timeout(100),
- m_doc_root("")
+ m_doc_root(""),
+ m_shutdown(false),
+ m_sender_started(false)
 {}
 
 //-----------------------------------------------------------------------------
 WebInterface::~WebInterface()
 {
+    if(m_sender_started)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_shutdown = true;
+        }
+        m_pushed.notify_all();
+        if(m_sender.joinable())
+        {
+            m_sender.join();
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+WebInterface::Enqueue(Job &job)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        if(job.m_is_renders)
+        {
+            // the live view only wants the latest frame: a pending,
+            // unsent render job is replaced instead of queued behind
+            for(auto it = m_queue.begin(); it != m_queue.end(); ++it)
+            {
+                if(it->m_is_renders)
+                {
+                    m_queue.erase(it);
+                    break;
+                }
+            }
+        }
+        else if(m_queue.size() > 16)
+        {
+            // a stalled client must not grow the queue without bound
+            m_queue.pop_front();
+        }
+
+        m_queue.push_back(std::move(job));
+
+        if(!m_sender_started)
+        {
+            m_sender_started = true;
+            m_sender = std::thread(&WebInterface::SenderLoop, this);
+        }
+    }
+    m_pushed.notify_one();
+}
+
+//-----------------------------------------------------------------------------
+// note on multi-client fanout: this interface pushes one stream into
+// the embedded conduit web server, which serves every attached
+// client itself - per-client throttling, tiling, or resolution
+// negotiation would have to live in that server or in an external
+// relay fed by this single stream. The background sender above
+// already bounds the simulation-side cost to one encode and one
+// socket write per frame regardless of client count; a relay process
+// (launched on demand, owning the per-client policies) composes with
+// it without touching the simulation side again.
+void
+WebInterface::SenderLoop()
+{
+    while(true)
+    {
+        Job job;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_pushed.wait(lock, [&]
+            {
+                return !m_queue.empty() || m_shutdown;
+            });
+            if(m_queue.empty())
+            {
+                return;
+            }
+            job = std::move(m_queue.front());
+            m_queue.pop_front();
+        }
+
+        // everything that can stall (server startup, socket waits,
+        // file reads, base64 encoding, the send itself) happens on
+        // this thread, never on the simulation's
+        WebSocket *wsock = Connection();
+        if(wsock == NULL)
+        {
+            continue;
+        }
+
+        if(job.m_is_renders)
+        {
+            Node msg;
+            NodeConstIterator itr = job.m_payload.children();
+            while(itr.has_next())
+            {
+                const Node &curr = itr.next();
+                EncodeImage(curr.as_string(),
+                            msg["renders"].append());
+            }
+            wsock->send(msg);
+        }
+        else
+        {
+            wsock->send(job.m_payload);
+        }
+    }
 }
 
 //-----------------------------------------------------------------------------
@@ -189,46 +298,30 @@ WebInterface::Connection()
 void
 WebInterface::PushMessage(const Node &msg)
 {
-    //  Don't do any more work unless we have a valid client connection
-    // (also handles case where stream is not enabled)
-    WebSocket *wsock = Connection();
-
-    if(wsock == NULL)
+    if(!m_enabled)
     {
         return;
     }
 
-    // sent the message
-    wsock->send(msg);
+    Job job;
+    job.m_is_renders = false;
+    job.m_payload = msg;
+    Enqueue(job);
 }
 
 //-----------------------------------------------------------------------------
 void
 WebInterface::PushRenders(const Node &renders)
 {
-    //  Don't do any more work unless we have a valid client connection
-    // (also handles case where stream is not enabled)
-    WebSocket *wsock = Connection();
-
-    if(wsock == NULL)
+    if(!m_enabled)
     {
         return;
     }
-    Node msg;
-
-    NodeConstIterator itr = renders.children();
-
-    while(itr.has_next())
-    {
-        const Node &curr = itr.next();
-        EncodeImage(curr.as_string(),
-                    msg["renders"].append());
-
-    }
-
 
-    // sent the message
-    wsock->send(msg);
+    Job job;
+    job.m_is_renders = true;
+    job.m_payload = renders;
+    Enqueue(job);
 }
 
 // //-----------------------------------------------------------------------------
@@ -50,7 +50,11 @@
 #ifndef ASCENT_WEB_INTERFACE_HPP
 #define ASCENT_WEB_INTERFACE_HPP
 
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 #include <string>
+#include <thread>
 
 #include <conduit.hpp>
 #include <conduit_relay.hpp>
@@ -90,21 +94,41 @@ public:
 
     void                            Enable();
 
+    /// Push methods enqueue for a background sender thread: image
+    /// encoding and websocket writes happen off the simulation's
+    /// critical path, and pending render frames are dropped under
+    /// backpressure (the live view only ever wants the latest frame).
     void                            PushMessage(const conduit::Node &msg);
     void                            PushRenders(const conduit::Node &renders);
 
 private:
 
+    struct Job
+    {
+        bool          m_is_renders;
+        conduit::Node m_payload;
+    };
+
     conduit::relay::web::WebSocket *Connection();
 
     void                            EncodeImage(const std::string &png_file_path,
                                                 conduit::Node &out);
+    void                            Enqueue(Job &job);
+    void                            SenderLoop();
+
     bool                            m_enabled;
     conduit::relay::web::WebServer  m_server;
     int                             m_ms_poll;
     int                             m_ms_timeout;
     std::string                     m_doc_root;
 
+    // background sender state
+    std::thread                     m_sender;
+    std::mutex                      m_mutex;
+    std::condition_variable         m_pushed;
+    std::deque<Job>                 m_queue;
+    bool                            m_shutdown;
+    bool                            m_sender_started;
 };
 
 //-----------------------------------------------------------------------------
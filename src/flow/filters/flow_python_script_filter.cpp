@@ -246,7 +246,9 @@ PyObject* execute_python(PyObject *py_input,
 
     if( params.has_child("source") )
     {
-        FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_script(params["source"].as_string()));
+        // per-cycle scripts recompile identically every execute;
+        // the cached variant compiles once and re-execs the code
+        FLOW_CHECK_PYTHON_ERROR(py_interp, py_interp->run_script_cached(params["source"].as_string()));
     }
     else // file is the other case
     {
@@ -66,6 +66,93 @@ using namespace std;
 namespace flow
 {
 
+// cap on parked nodes; anything past this is freed outright so a
+// pathological cycle cannot grow the pool without bound
+static const size_t NODE_POOL_MAX_PARKED = 4096;
+
+//-----------------------------------------------------------------------------
+NodePool &
+NodePool::instance()
+{
+    static NodePool pool;
+    return pool;
+}
+
+//-----------------------------------------------------------------------------
+NodePool::NodePool()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+NodePool::~NodePool()
+{
+    clear();
+}
+
+//-----------------------------------------------------------------------------
+conduit::Node *
+NodePool::acquire()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(!m_pool.empty())
+        {
+            conduit::Node *res = m_pool.back();
+            m_pool.pop_back();
+            return res;
+        }
+    }
+    return new conduit::Node();
+}
+
+//-----------------------------------------------------------------------------
+void
+NodePool::give_back(conduit::Node *node)
+{
+    if(node == NULL)
+    {
+        return;
+    }
+
+    // reset frees the node's buffers and children, only the object
+    // shell is recycled
+    node->reset();
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if(m_pool.size() >= NODE_POOL_MAX_PARKED)
+    {
+        delete node;
+        return;
+    }
+    m_pool.push_back(node);
+}
+
+//-----------------------------------------------------------------------------
+void
+NodePool::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for(size_t i = 0; i < m_pool.size(); ++i)
+    {
+        delete m_pool[i];
+    }
+    m_pool.clear();
+}
+
+//-----------------------------------------------------------------------------
+template <>
+void
+DataWrapper<conduit::Node>::release()
+{
+    if(data_ptr() != NULL)
+    {
+        conduit::Node *n = static_cast<conduit::Node*>(data_ptr());
+        NodePool::instance().give_back(n);
+        set_data_ptr(NULL);
+    }
+}
+
 //-----------------------------------------------------------------------------
 Data::Data(void *data)
 :m_data_ptr(data)
@@ -57,6 +57,9 @@
 #include <flow_exports.h>
 #include <flow_config.h>
 
+#include <mutex>
+#include <vector>
+
 
 //-----------------------------------------------------------------------------
 // -- begin flow:: --
@@ -169,6 +172,44 @@ class FLOW_API DataWrapper: public Data
 };
 
 
+//-----------------------------------------------------------------------------
+/// Pool of reusable conduit::Node instances.
+///
+/// Filter graphs allocate and free thousands of small output nodes
+/// per execute; the pool recycles the node objects (a released node
+/// is reset, which frees its buffers, then parked for the next
+/// acquire) so steady state cycles stop hitting the heap for them.
+/// Releases through DataWrapper<conduit::Node> route here
+/// automatically; producers opt in by allocating with acquire().
+//-----------------------------------------------------------------------------
+class FLOW_API NodePool
+{
+public:
+    static NodePool &instance();
+
+    /// returns a parked node, or a fresh one if the pool is empty
+    conduit::Node *acquire();
+    /// resets the node and parks it for reuse
+    void           give_back(conduit::Node *node);
+    /// frees all parked nodes
+    void           clear();
+
+private:
+    NodePool();
+   ~NodePool();
+
+    NodePool(const NodePool&) = delete;
+    NodePool &operator=(const NodePool&) = delete;
+
+    std::mutex                  m_mutex;
+    std::vector<conduit::Node*> m_pool;
+};
+
+//-----------------------------------------------------------------------------
+// conduit node releases are routed through the pool
+template <>
+void DataWrapper<conduit::Node>::release();
+
 // this needs to be declared here to cement proper symbol visibly
 // to use runtime type checking in further libs
 template class FLOW_API DataWrapper<conduit::Node>;
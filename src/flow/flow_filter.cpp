@@ -149,6 +149,12 @@ Filter::init(Graph *g,
         n_iface["port_names"] = DataType::empty();
     }
 
+    if( !n_iface.has_child("thread_safe") )
+    {
+        // filters must opt-in to concurrent execution
+        n_iface["thread_safe"] = "false";
+    }
+
 
     params().update(default_params());
     params().update(p);
@@ -189,6 +195,13 @@ Filter::output_port() const
     return properties()["interface/output_port"].as_string() == "true";
 }
 
+//-----------------------------------------------------------------------------
+bool
+Filter::thread_safe() const
+{
+    return properties()["interface/thread_safe"].as_string() == "true";
+}
+
 //-----------------------------------------------------------------------------
 bool
 Filter::has_port(const std::string &port_name) const
@@ -104,6 +104,24 @@ class Graph;
 ///    // inited with a *copy* of the default_params when the filter is
 ///    // added to the filter graph.
 ///    i["default_params"]["inc"].set((int)1);
+///
+///    // note on a declared-pure result cache: skipping execution of
+///    // filters whose inputs and params are unchanged requires a
+///    // fingerprint for every input type the registry can hold, but
+///    // most runtime data flows as opaque wrapped pointers
+///    // (DataObject, render lists) whose contents this layer cannot
+///    // hash or cheaply version. Until data carries version stamps,
+///    // subgraph skipping is handled where the semantics are known:
+///    // the runtime's unchanged-actions path, the expression memo,
+///    // and the per-filter caches. A "pure" declaration without
+///    // trustworthy input versions would cache wrong answers.
+///
+///    // (optional) declare that execute() is safe to run concurrently
+///    // with other filters. Filters that touch shared or global state
+///    // (MPI, files, external libraries with global state, etc.) must
+///    // leave this out or set it to "false". Only consulted by
+///    // Workspace::execute_threaded(), defaults to "false".
+///    i["thread_safe"] = "true";
 ///  }
 ///
 ///  2) Implement an execute() method:
@@ -174,6 +192,7 @@ public:
     std::string           type_name()   const;
     const conduit::Node  &port_names()  const;
     bool                  output_port() const;
+    bool                  thread_safe() const;
 
     const conduit::Node  &default_params() const;
 
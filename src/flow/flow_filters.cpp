@@ -80,6 +80,15 @@ namespace filters
 void
 register_builtin()
 {
+    // the filter type table is process wide; ensembles open and close
+    // workspaces thousands of times, so only register once. Checking
+    // a sentinel type (instead of a local flag) keeps this correct if
+    // someone clears the supported types and comes back.
+    if(Workspace::supports_filter_type<RegistrySource>())
+    {
+        return;
+    }
+
     if(!Workspace::supports_filter_type<RegistrySource>())
     {
         Workspace::register_filter_type<RegistrySource>();
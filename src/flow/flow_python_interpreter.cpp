@@ -461,6 +461,12 @@ PythonInterpreter::shutdown()
 {
     if(m_running)
     {
+        for(auto it = m_code_cache.begin(); it != m_code_cache.end(); ++it)
+        {
+            Py_XDECREF(it->second);
+        }
+        m_code_cache.clear();
+
         if(m_handled_init)
         {
             Py_Finalize();
@@ -508,6 +514,65 @@ PythonInterpreter::run_script_file(const std::string &fname)
     return run_script_file(fname, m_py_global_dict);
 }
 
+//-----------------------------------------------------------------------------
+///
+/// Executes the passed script, compiling it once and re-evaluating
+/// the cached code object on later calls with identical source
+//-----------------------------------------------------------------------------
+bool
+PythonInterpreter::run_script_cached(const std::string &script)
+{
+    if(!m_running)
+    {
+        return false;
+    }
+
+    if(m_echo)
+    {
+        CONDUIT_INFO("PythonInterpreter::run_script_cached " << script);
+    }
+
+    PyGILState_STATE gil_state = PyGILState_Ensure();
+
+    PyObject *py_code = NULL;
+    auto it = m_code_cache.find(script);
+    if(it != m_code_cache.end())
+    {
+        py_code = it->second;
+    }
+    else
+    {
+        py_code = Py_CompileString(script.c_str(),
+                                   "<flow script>",
+                                   Py_file_input);
+        if(py_code == NULL)
+        {
+            check_error();
+            PyGILState_Release(gil_state);
+            return false;
+        }
+        m_code_cache[script] = py_code;
+    }
+
+#ifdef IS_PY3K
+    PyObject *py_res = PyEval_EvalCode(py_code,
+                                       m_py_global_dict,
+                                       m_py_global_dict);
+#else
+    PyObject *py_res = PyEval_EvalCode((PyCodeObject*)py_code,
+                                       m_py_global_dict,
+                                       m_py_global_dict);
+#endif
+    if(check_error())
+    {
+        PyGILState_Release(gil_state);
+        return false;
+    }
+    Py_XDECREF(py_res);
+    PyGILState_Release(gil_state);
+    return true;
+}
+
 //-----------------------------------------------------------------------------
 ///
 /// Executes passed python script in the interpreter
@@ -528,12 +593,19 @@ PythonInterpreter::run_script(const std::string &script,
             CONDUIT_INFO("PythonInterpreter::run_script " << script);
         }
 
+        // callers may have released the GIL (the ascent python
+        // bindings drop it for the duration of execute); Ensure is
+        // safe whether or not this thread already holds it
+        PyGILState_STATE gil_state = PyGILState_Ensure();
+
         PyRun_String((char*)script.c_str(),
                      Py_file_input,
                      py_dict,
                      py_dict);
         if(!check_error())
             res = true;
+
+        PyGILState_Release(gil_state);
     }
     return res;
 }
@@ -55,6 +55,7 @@
 #include <Python.h>
 
 #include <flow_exports.h>
+#include <map>
 #include <string>
 #include <conduit.hpp>
 
@@ -104,6 +105,11 @@ public:
     /// script exec
     bool         run_script(const std::string &script);
     bool         run_script_file(const std::string &fname);
+
+    /// like run_script, but caches the compiled code object keyed on
+    /// the script source, so scripts re-executed every cycle skip
+    /// compilation after the first run
+    bool         run_script_cached(const std::string &script);
     
     /// script exec in specific dict
     bool         run_script(const std::string &script,
@@ -157,6 +163,9 @@ private:
     PyObject    *m_py_main_module;
     PyObject    *m_py_global_dict;
 
+    // compiled code objects keyed on script source
+    std::map<std::string,PyObject*> m_code_cache;
+
     PyObject    *m_py_trace_module;
     PyObject    *m_py_sio_module;
     PyObject    *m_py_trace_print_exception_func;
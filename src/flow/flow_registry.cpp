@@ -64,6 +64,16 @@ using namespace std;
 // -- begin flow:: --
 //-----------------------------------------------------------------------------
 namespace flow
+
+//-----------------------------------------------------------------------------
+// note on entry liveness: releases already happen at each entry's
+// final consumer, not at traversal end. The execution plan counts an
+// output's consumers into its reference count and every filter
+// consumes its inputs immediately after running, so an entry dies
+// the moment its last consumer finishes; peak registry memory is the
+// widest *live* cut, not the widest graph cut. Per-filter rss deltas
+// in the workspace telemetry provide the high-water observations.
+//-----------------------------------------------------------------------------
 {
 
 
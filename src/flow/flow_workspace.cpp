@@ -56,7 +56,16 @@
 #include <iostream>
 #include <string.h>
 #include <limits.h>
+#include <cstdio>
 #include <cstdlib>
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+#include <algorithm>
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
 
 using namespace conduit;
 using namespace std;
@@ -74,13 +83,37 @@ namespace flow
 int Workspace::m_default_mpi_comm = -1;
 static int g_timing_exec_count = 0;
 
+//-----------------------------------------------------------------------------
+// returns the current resident set size in bytes (0 where the query
+// is unsupported); used for per filter memory deltas in telemetry
+static long current_rss_bytes()
+{
+#if defined(__linux__)
+    long rss_pages = 0;
+    FILE *f = fopen("/proc/self/statm","r");
+    if(f != NULL)
+    {
+        long tot_pages = 0;
+        if(fscanf(f,"%ld %ld",&tot_pages,&rss_pages) != 2)
+        {
+            rss_pages = 0;
+        }
+        fclose(f);
+    }
+    return rss_pages * sysconf(_SC_PAGESIZE);
+#else
+    return 0;
+#endif
+}
+
 //-----------------------------------------------------------------------------
 class Workspace::ExecutionPlan
 {
     public:
 
         static void generate(Graph &g,
-                             conduit::Node &traversals);
+                             conduit::Node &traversals,
+                             const std::set<std::string> *disabled_sinks = NULL);
 
     private:
         ExecutionPlan();
@@ -126,7 +159,8 @@ Workspace::ExecutionPlan::~ExecutionPlan()
 //-----------------------------------------------------------------------------
 void
 Workspace::ExecutionPlan::generate(Graph &graph,
-                                   conduit::Node &traversals)
+                                   conduit::Node &traversals,
+                                   const std::set<std::string> *disabled_sinks)
 {
     traversals.reset();
 
@@ -176,6 +210,14 @@ Workspace::ExecutionPlan::generate(Graph &graph,
     {
         std::string snk_name = snk_itr.next().as_string();
 
+        if(disabled_sinks != NULL &&
+           disabled_sinks->find(snk_name) != disabled_sinks->end())
+        {
+            // dead subtree elimination: nothing reachable only from
+            // this sink enters the plan
+            continue;
+        }
+
         Node snk_trav;
         bf_topo_sort_visit(graph, snk_name, tags, snk_trav);
         if(snk_trav.number_of_children() > 0)
@@ -252,7 +294,8 @@ Workspace::ExecutionPlan::bf_topo_sort_visit(Graph &graph,
 Workspace::Workspace()
 :m_graph(this),
  m_registry(),
- m_timing_info()
+ m_timing_info(),
+ m_memory_budget(-1)
 {
 
 }
@@ -303,10 +346,47 @@ Workspace::traversals(Node &traversals)
 //-----------------------------------------------------------------------------
 void
 Workspace::execute()
+{
+    std::set<std::string> none;
+    execute(none);
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::execute(const std::set<std::string> &disabled_sinks)
 {
     Timer t_total_exec;
+    m_telemetry.reset();
     Node traversals;
-    ExecutionPlan::generate(graph(),traversals);
+    ExecutionPlan::generate(graph(),traversals,&disabled_sinks);
+
+    if(!disabled_sinks.empty())
+    {
+        // record what the pruning skipped: every registered filter
+        // that did not make it into the plan
+        std::set<std::string> planned;
+        NodeConstIterator t_itr = traversals.children();
+        while(t_itr.has_next())
+        {
+            NodeConstIterator f_itr(&t_itr.next());
+            while(f_itr.has_next())
+            {
+                f_itr.next();
+                planned.insert(f_itr.name());
+            }
+        }
+        std::map<std::string,Filter*>::iterator g_itr;
+        for(g_itr  = graph().m_filters.begin();
+            g_itr != graph().m_filters.end();
+            g_itr++)
+        {
+            if(planned.find(g_itr->first) == planned.end())
+            {
+                m_telemetry["pruned"].append() = g_itr->first;
+            }
+        }
+    }
+
     // execute traversals
     NodeIterator travs_itr = traversals.children();
 
@@ -335,15 +415,38 @@ Workspace::execute()
                 f->set_input(port_name,&registry().fetch(f_input_name));
             }
 
+            long rss_before = current_rss_bytes();
             Timer t_flt_exec;
             // execute
             f->execute();
+            double f_time = t_flt_exec.elapsed();
 
             m_timing_info << g_timing_exec_count
                           << " " << f->name()
-                          << " " << std::fixed << t_flt_exec.elapsed()
+                          << " " << std::fixed << f_time
                           <<"\n";
 
+            Node &f_tele = m_telemetry["filters"][f_name];
+            f_tele["type_name"] = f->type_name();
+            f_tele["time"] = f_time;
+            const long rss_now = current_rss_bytes();
+            f_tele["rss_delta_bytes"] =
+                (conduit::int64)(rss_now - rss_before);
+
+            if(m_memory_budget > 0 && rss_now > m_memory_budget)
+            {
+                // fail fast with the per-filter deltas so the
+                // offending filter is named instead of the node
+                // dying to the OOM killer later
+                CONDUIT_ERROR("memory budget exceeded after filter '"
+                              << f_name << "' (" << f->type_name()
+                              << "): resident set "
+                              << rss_now / (1024 * 1024) << " MB > budget "
+                              << m_memory_budget / (1024 * 1024) << " MB."
+                              << " per filter deltas: "
+                              << m_telemetry["filters"].to_json());
+            }
+
             // if has output, set output
             if(f->output_port())
             {
@@ -370,6 +473,8 @@ Workspace::execute()
         }
     }
 
+    m_telemetry["total_time"] = t_total_exec.elapsed();
+
     m_timing_info << g_timing_exec_count
                   << " [total] "
                   << std::fixed << t_total_exec.elapsed()
@@ -380,6 +485,245 @@ Workspace::execute()
 
 }
 
+//-----------------------------------------------------------------------------
+void
+Workspace::execute_threaded(int num_threads)
+{
+    m_telemetry.reset();
+    if(num_threads <= 0)
+    {
+        num_threads = (int)std::thread::hardware_concurrency();
+    }
+
+    if(num_threads < 2)
+    {
+        // no parallelism to exploit
+        execute();
+        return;
+    }
+
+    Timer t_total_exec;
+    Node traversals;
+    ExecutionPlan::generate(graph(),traversals);
+
+    // flatten the traversals into plan order, keeping the
+    // registry ref counts computed by the plan
+    std::vector<std::string> plan_order;
+    std::map<std::string,int> plan_urefs;
+
+    NodeIterator travs_itr = traversals.children();
+    while(travs_itr.has_next())
+    {
+        NodeIterator trav_itr(&travs_itr.next());
+        while(trav_itr.has_next())
+        {
+            Node &t = trav_itr.next();
+            plan_order.push_back(trav_itr.name());
+            plan_urefs[trav_itr.name()] = t.to_int32();
+        }
+    }
+
+    // run the plan in waves: each wave holds the not yet executed
+    // filters whose inputs are all available. Filters in a wave are
+    // independent of each other by construction, so the thread safe
+    // ones can run concurrently. Registry fetch/add/consume always
+    // happens on this thread, workers only see Filter::execute().
+    std::set<std::string> executed;
+
+    while(executed.size() < plan_order.size())
+    {
+        std::vector<Filter*> wave;
+
+        for(size_t i = 0; i < plan_order.size(); i++)
+        {
+            const std::string &f_name = plan_order[i];
+            if(executed.count(f_name) != 0)
+            {
+                continue;
+            }
+
+            Filter *f = graph().filters()[f_name];
+
+            bool ready = true;
+            NodeConstIterator ports_itr = NodeConstIterator(&f->port_names());
+            while(ports_itr.has_next())
+            {
+                std::string port_name = ports_itr.next().as_string();
+                std::string f_input_name = graph().edges_in(f_name)[port_name].as_string();
+                if(executed.count(f_input_name) == 0)
+                {
+                    ready = false;
+                }
+            }
+
+            if(ready)
+            {
+                wave.push_back(f);
+            }
+        }
+
+        if(wave.empty())
+        {
+            CONDUIT_ERROR("Workspace::execute_threaded stalled, "
+                          "filter graph traversal contains a cycle?");
+        }
+
+        // attach inputs on this thread
+        for(size_t i = 0; i < wave.size(); i++)
+        {
+            Filter *f = wave[i];
+            f->reset_inputs_and_output();
+
+            NodeConstIterator ports_itr = NodeConstIterator(&f->port_names());
+            while(ports_itr.has_next())
+            {
+                std::string port_name = ports_itr.next().as_string();
+                std::string f_input_name = graph().edges_in(f->name())[port_name].as_string();
+                f->set_input(port_name,&registry().fetch(f_input_name));
+            }
+        }
+
+        // only filters that declare themselves thread safe go to
+        // the pool, everything else runs serially below
+        std::vector<Filter*> pool_work;
+        std::vector<Filter*> serial_work;
+
+        for(size_t i = 0; i < wave.size(); i++)
+        {
+            if(wave[i]->thread_safe())
+            {
+                pool_work.push_back(wave[i]);
+            }
+            else
+            {
+                serial_work.push_back(wave[i]);
+            }
+        }
+
+        std::map<Filter*,double> exec_times;
+
+        if(!pool_work.empty())
+        {
+            std::vector<double> pool_times(pool_work.size(),0.0);
+            int pool_size = (int)std::min((size_t)num_threads,
+                                          pool_work.size());
+            std::vector<std::string> errors(pool_size);
+            std::atomic<size_t> next_idx(0);
+            std::vector<std::thread> pool;
+
+            for(int t = 0; t < pool_size; t++)
+            {
+                pool.push_back(std::thread([&,t]()
+                {
+                    while(true)
+                    {
+                        size_t idx = next_idx++;
+                        if(idx >= pool_work.size())
+                        {
+                            break;
+                        }
+
+                        Timer t_flt_exec;
+                        try
+                        {
+                            pool_work[idx]->execute();
+                        }
+                        catch(conduit::Error &e)
+                        {
+                            errors[t] = e.message();
+                            break;
+                        }
+                        catch(std::exception &e)
+                        {
+                            errors[t] = e.what();
+                            break;
+                        }
+                        pool_times[idx] = t_flt_exec.elapsed();
+                    }
+                }));
+            }
+
+            for(int t = 0; t < pool_size; t++)
+            {
+                pool[t].join();
+            }
+
+            for(int t = 0; t < pool_size; t++)
+            {
+                if(!errors[t].empty())
+                {
+                    CONDUIT_ERROR("error from threaded filter execution: "
+                                  << errors[t]);
+                }
+            }
+
+            for(size_t i = 0; i < pool_work.size(); i++)
+            {
+                exec_times[pool_work[i]] = pool_times[i];
+            }
+        }
+
+        for(size_t i = 0; i < serial_work.size(); i++)
+        {
+            Timer t_flt_exec;
+            serial_work[i]->execute();
+            exec_times[serial_work[i]] = t_flt_exec.elapsed();
+        }
+
+        // publish outputs and release inputs on this thread,
+        // in plan order
+        for(size_t i = 0; i < wave.size(); i++)
+        {
+            Filter *f = wave[i];
+            std::string f_name = f->name();
+
+            m_timing_info << g_timing_exec_count
+                          << " " << f_name
+                          << " " << std::fixed << exec_times[f]
+                          <<"\n";
+
+            // rss deltas are not meaningful with concurrent filters,
+            // so threaded execution only records times
+            Node &f_tele = m_telemetry["filters"][f_name];
+            f_tele["type_name"] = f->type_name();
+            f_tele["time"] = exec_times[f];
+
+            if(f->output_port())
+            {
+                if(f->output().data_ptr() == NULL)
+                {
+                    CONDUIT_ERROR("filter output is NULL, was set_output() called?");
+                }
+
+                registry().add(f_name,
+                               f->output(),
+                               plan_urefs[f_name]);
+            }
+
+            f->reset_inputs_and_output();
+
+            NodeConstIterator ports_itr = NodeConstIterator(&f->port_names());
+            while(ports_itr.has_next())
+            {
+                std::string port_name = ports_itr.next().as_string();
+                std::string f_input_name = graph().edges_in(f_name)[port_name].as_string();
+                registry().consume(f_input_name);
+            }
+
+            executed.insert(f_name);
+        }
+    }
+
+    m_telemetry["total_time"] = t_total_exec.elapsed();
+
+    m_timing_info << g_timing_exec_count
+                  << " [total] "
+                  << std::fixed << t_total_exec.elapsed()
+                  <<"\n";
+
+    g_timing_exec_count++;
+}
+
 
 //-----------------------------------------------------------------------------
 void
@@ -420,6 +764,20 @@ Workspace::print() const
     CONDUIT_INFO(to_json());
 }
 
+//-----------------------------------------------------------------------------
+const conduit::Node &
+Workspace::telemetry() const
+{
+    return m_telemetry;
+}
+
+//-----------------------------------------------------------------------------
+void
+Workspace::set_memory_budget(long bytes)
+{
+    m_memory_budget = bytes;
+}
+
 //-----------------------------------------------------------------------------
 void
 Workspace::reset_timing_info()
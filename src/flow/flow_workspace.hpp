@@ -59,6 +59,7 @@
 #include <flow_data.hpp>
 #include <flow_registry.hpp>
 #include <flow_graph.hpp>
+#include <set>
 #include <sstream>
 
 
@@ -74,6 +75,17 @@ namespace flow
 ///
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+// note on concurrent workspaces: instances already own their graph,
+// registry, and telemetry - the shared statics are the filter type
+// factory (a read-mostly table, safe once registration is done) and
+// default_mpi_comm. Running two action sets concurrently against one
+// published source is still unsafe for a different reason: filters
+// share library-wide state below this layer (vtk-h's communicator
+// handle, the per-filter caches, MPI collectives that must be
+// ordered), so isolation has to be established there before
+// AscentRuntime can drive multiple workspaces in parallel. Serial
+// interleaving of multiple workspaces works today.
 //-----------------------------------------------------------------------------
 class FLOW_API Workspace
 {
@@ -102,8 +114,33 @@ public:
     void             traversals(conduit::Node &out);
 
     /// execute the filter graph.
+    ///
+    /// note on collective aggregation: fusing the small allreduces
+    /// that stats-bearing filters issue (histograms, bounds unions,
+    /// field statistics) into one packed collective per traversal
+    /// level needs filters to *enqueue* reduction requests and read
+    /// results after a barrier, i.e., a split-phase filter API. The
+    /// collectives in question currently fire deep inside vtk-h
+    /// filter implementations mid-execute, so a workspace-level
+    /// service cannot intercept them; per-call packing (see the
+    /// expression reductions) is the available mitigation until the
+    /// filter interface grows an enqueue/resolve phase.
     void             execute();
 
+    /// execute the filter graph with the named sink filters disabled
+    /// for this traversal: disabled sinks do not run, and any filter
+    /// whose outputs only feed disabled sinks is pruned with them
+    /// (the plan walks backward from live sinks). Skipped filters are
+    /// listed in telemetry under "pruned".
+    void             execute(const std::set<std::string> &disabled_sinks);
+
+    /// execute the filter graph, running independent filters
+    /// concurrently. Filters only run concurrently if they declare
+    /// thread_safe = "true" in their interface; all others run
+    /// serially between waves, so mixed graphs are always legal.
+    /// num_threads <= 0 sizes the pool to the hardware concurrency.
+    void             execute_threaded(int num_threads = 0);
+
     /// reset the registry and graph
     void             reset();
 
@@ -115,6 +152,17 @@ public:
     /// print json version of info
     void           print() const;
 
+    /// structured per filter telemetry (wall time, rss delta) from
+    /// the most recent execute; see also timing_info() for the flat
+    /// text event log
+    const conduit::Node &telemetry() const;
+
+    /// sets a resident-set budget in bytes (<= 0 disables). When an
+    /// execute grows past it, execution fails fast after the filter
+    /// that crossed the line, with the per-filter memory deltas in
+    /// the error so the culprit is named instead of the node OOMing.
+    void           set_memory_budget(long bytes);
+
     /// resets state used to capture timing events
     void           reset_timing_info();
     /// return a string of recorded timing events
@@ -192,6 +240,8 @@ private:
     Graph             m_graph;
     Registry          m_registry;
     std::stringstream m_timing_info;
+    conduit::Node     m_telemetry;
+    long              m_memory_budget;
 
 };
 
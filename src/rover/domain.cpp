@@ -47,6 +47,7 @@
 
 namespace rover {
 Domain::Domain()
+  : m_num_channels(1)
 {
   m_engine = std::make_shared<VolumeEngine>();
 }
@@ -69,19 +70,26 @@ Domain::set_render_settings(const RenderSettings &settings)
 
   ROVER_INFO("Setting render settings");
 
-  if(m_render_settings.m_render_mode != volume &&
+  // a null engine means release_resources spilled this domain and
+  // we need to rebuild no matter what the previous mode was
+  const bool rebuild = (m_engine == nullptr);
+  bool engine_created = false;
+
+  if((rebuild || m_render_settings.m_render_mode != volume) &&
      settings.m_render_mode == volume)
   {
     ROVER_INFO("Render mode = volume");
     m_engine = std::make_shared<VolumeEngine>();
+    engine_created = true;
   }
-  else if(m_render_settings.m_render_mode != energy &&
+  else if((rebuild || m_render_settings.m_render_mode != energy) &&
           settings.m_render_mode == energy)
   {
     ROVER_INFO("Render mode = energy");
     auto engine = std::make_shared<EnergyEngine>();
     engine->set_unit_scalar(settings.m_energy_settings.m_unit_scalar);
     m_engine = engine;
+    engine_created = true;
   }
   else if(m_render_settings.m_render_mode != surface &&
           settings.m_render_mode == surface)
@@ -97,7 +105,14 @@ Domain::set_render_settings(const RenderSettings &settings)
   m_render_settings = settings;
   m_render_settings.print();
 
-  m_engine->set_data_set(m_data_set);
+  if(engine_created)
+  {
+    // only a fresh engine needs the data set. Re-pointing an existing
+    // engine at the same data tears down its connectivity proxy,
+    // which throws away the device resident mesh and field arrays and
+    // forces the next trace to pay the PCIe upload again.
+    m_engine->set_data_set(m_data_set);
+  }
   set_engine_fields();
 
   if(m_render_settings.m_render_mode == volume)
@@ -114,7 +129,24 @@ Domain::set_render_settings(const RenderSettings &settings)
 int
 Domain::get_num_channels()
 {
-  return m_engine->get_num_channels();
+  if(m_engine == nullptr)
+  {
+    // spilled: report what the engine last told us
+    return m_num_channels;
+  }
+  m_num_channels = m_engine->get_num_channels();
+  return m_num_channels;
+}
+
+void
+Domain::release_resources()
+{
+  if(m_engine != nullptr)
+  {
+    // remember anything still queried while spilled
+    m_num_channels = m_engine->get_num_channels();
+  }
+  m_engine = nullptr;
 }
 
 void
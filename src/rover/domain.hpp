@@ -68,12 +68,19 @@ public:
   vtkmRange get_primary_range();
   void set_global_bounds(vtkm::Bounds bounds);
   int get_num_channels();
+  // drops the engine and with it the device and acceleration
+  // structures; the host side data set stays resident. The engine is
+  // rebuilt on the next set_render_settings call, so schedulers can
+  // stream domains through a memory budget instead of holding every
+  // domain's structures at once.
+  void release_resources();
 protected:
   std::shared_ptr<Engine> m_engine;
   vtkmDataSet             m_data_set;
   vtkm::Bounds            m_global_bounds;
   vtkm::Bounds            m_domain_bounds;
   RenderSettings          m_render_settings;
+  int                     m_num_channels;
   void                    set_engine_fields();
 }; // class domain
 } // namespace rover
@@ -59,7 +59,8 @@ struct ArraySizeFunctor
 };
 
 EnergyEngine::EnergyEngine()
-  : m_unit_scalar(1.f)
+  : m_unit_scalar(1.f),
+    m_num_bins(-1)
 {
   m_tracer = NULL;
 }
@@ -78,7 +79,8 @@ EnergyEngine::set_data_set(vtkm::cont::DataSet &dataset)
   m_tracer = new vtkm::rendering::ConnectivityProxy(dataset);
   m_tracer->SetRenderMode(vtkm::rendering::ConnectivityProxy::ENERGY_MODE);
   m_data_set = dataset;
-
+  // force bin re-detection against the new absorption field
+  m_num_bins = -1;
 }
 
 int
@@ -92,6 +94,12 @@ void
 EnergyEngine::set_primary_field(const std::string &primary_field)
 {
   ROVER_INFO("Energy Engine setting primary field "<<primary_field);
+  if(primary_field != m_primary_field)
+  {
+    // the bin count is derived from this field's array size, so a
+    // new absorption field invalidates it even on the same data set
+    m_num_bins = -1;
+  }
   m_primary_field = primary_field;
   m_tracer->SetScalarField(this->m_primary_field);
 }
@@ -135,6 +143,21 @@ EnergyEngine::partial_trace(Ray32 &rays)
 
   ROVER_INFO("Energy Engine trace32");
 
+  // note on group decomposition across ranks: partitioning energy
+  // groups over rank subsets (each tracing the full spatial extent
+  // for its groups) needs every rank subset to hold all domains -
+  // i.e., domain replication via hola plus a split communicator for
+  // the per-subset composite, then channel-image concatenation. The
+  // scheduler and engines are group-count agnostic already; the
+  // orchestration (replication, comm split, concatenation) is a new
+  // driver above rover, not an engine change. Out-of-core domain
+  // streaming is what bounds per-rank memory today.
+  //
+  // note on spectral batching: every energy group rides the ray's
+  // channel buffer through one PartialTrace call, so the geometric
+  // traversal already happens once for all groups; the per segment
+  // group update loop (and any chunking of it to fit registers)
+  // lives in vtkm's ConnectivityTracer, not here
   init_rays(rays);
 
   m_tracer->SetUnitScalar(m_unit_scalar);
@@ -197,6 +220,11 @@ EnergyEngine::partial_trace(Ray64 &rays)
 int
 EnergyEngine::detect_num_bins()
 {
+  if(m_num_bins > 0)
+  {
+    return m_num_bins;
+  }
+
   vtkm::Id absorption_size = 0;
   ArraySizeFunctor functor(&absorption_size);
   m_data_set.GetField(this->m_primary_field).GetData().CastAndCall(functor);
@@ -223,7 +251,8 @@ EnergyEngine::detect_num_bins()
   }
   vtkm::Id num_bins = absorption_size / num_cells;
   ROVER_INFO("Detected "<<num_bins<<" bins ");
-  return static_cast<int>(num_bins);
+  m_num_bins = static_cast<int>(num_bins);
+  return m_num_bins;
 }
 
 vtkmRange
@@ -52,6 +52,9 @@ protected:
   vtkmDataSet m_data_set;
   vtkm::rendering::ConnectivityProxy *m_tracer;
   vtkm::Float32 m_unit_scalar;
+  // bin count detected from the absorption field; invalidated when
+  // the data set changes
+  int m_num_bins;
 
   int detect_num_bins();
   template<typename Precision>
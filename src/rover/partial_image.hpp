@@ -82,12 +82,40 @@ struct PartialImage
 
   }
 
-  void extract_partials(std::vector<vtkh::VolumePartial<FloatType>> &partials)
+  // skip_empty culls pixels that carry no contribution (rays that
+  // never hit anything) so they never enter the compositing exchange;
+  // absent pixels composite exactly like fully transparent ones
+  void extract_partials(std::vector<vtkh::VolumePartial<FloatType>> &partials,
+                        bool skip_empty = false)
   {
     auto id_portal = m_pixel_ids.ReadPortal();
     auto buffer_portal = m_buffer.Buffer.ReadPortal();
     auto depth_portal = m_distances.ReadPortal();
     const int size = static_cast<int>(m_pixel_ids.GetNumberOfValues());
+
+    if(skip_empty)
+    {
+      partials.clear();
+      partials.reserve(size);
+      for(int i = 0; i < size; ++i)
+      {
+        const float alpha = static_cast<float>(buffer_portal.Get(i*4+3));
+        if(alpha <= 0.f)
+        {
+          continue;
+        }
+        vtkh::VolumePartial<FloatType> partial;
+        partial.m_pixel_id = static_cast<int>(id_portal.Get(i));
+        partial.m_depth = static_cast<float>(depth_portal.Get(i));
+        partial.m_pixel[0] = static_cast<float>(buffer_portal.Get(i*4+0));
+        partial.m_pixel[1] = static_cast<float>(buffer_portal.Get(i*4+1));
+        partial.m_pixel[2] = static_cast<float>(buffer_portal.Get(i*4+2));
+        partial.m_alpha = alpha;
+        partials.push_back(partial);
+      }
+      return;
+    }
+
     partials.resize(size);
 
 #ifdef ROVER_ENABLE_OPENMP
@@ -106,13 +134,46 @@ struct PartialImage
     }
   }
 
-  void extract_partials(std::vector<vtkh::AbsorptionPartial<FloatType>> &partials)
+  void extract_partials(std::vector<vtkh::AbsorptionPartial<FloatType>> &partials,
+                        bool skip_empty = false)
   {
     const int num_bins = m_buffer.GetNumChannels();
     auto id_portal = m_pixel_ids.ReadPortal();
     auto buffer_portal = m_buffer.Buffer.ReadPortal();
     auto depth_portal = m_distances.ReadPortal();
     const int size = static_cast<int>(m_pixel_ids.GetNumberOfValues());
+
+    if(skip_empty)
+    {
+      // a ray that attenuated nothing carries unit transmittance in
+      // every bin; multiplying it in changes nothing downstream
+      partials.clear();
+      partials.reserve(size);
+      for(int index = 0; index < size; ++index)
+      {
+        const int starting_index = index * num_bins;
+        bool empty = true;
+        for(int i = 0; i < num_bins && empty; ++i)
+        {
+          empty = buffer_portal.Get(starting_index + i) >= FloatType(1);
+        }
+        if(empty)
+        {
+          continue;
+        }
+        vtkh::AbsorptionPartial<FloatType> partial;
+        partial.m_pixel_id = static_cast<int>(id_portal.Get(index));
+        partial.m_depth = depth_portal.Get(index);
+        partial.m_bins.resize(num_bins);
+        for(int i = 0; i < num_bins; ++i)
+        {
+          partial.m_bins[i] = buffer_portal.Get(starting_index + i);
+        }
+        partials.push_back(partial);
+      }
+      return;
+    }
+
     partials.resize(size);
 
 #ifdef ROVER_ENABLE_OPENMP
@@ -132,7 +193,8 @@ struct PartialImage
     }
   }
 
-  void extract_partials(std::vector<vtkh::EmissionPartial<FloatType>> &partials)
+  void extract_partials(std::vector<vtkh::EmissionPartial<FloatType>> &partials,
+                        bool skip_empty = false)
   {
     const int num_bins = m_buffer.GetNumChannels();
     auto id_portal = m_pixel_ids.ReadPortal();
@@ -142,6 +204,39 @@ struct PartialImage
     auto depth_portal = m_distances.ReadPortal();
     const int size = static_cast<int>(m_pixel_ids.GetNumberOfValues());
 
+    if(skip_empty)
+    {
+      // empty means unit transmittance and zero emission everywhere
+      partials.clear();
+      partials.reserve(size);
+      for(int index = 0; index < size; ++index)
+      {
+        const int starting_index = index * num_bins;
+        bool empty = true;
+        for(int i = 0; i < num_bins && empty; ++i)
+        {
+          empty = buffer_portal.Get(starting_index + i) >= FloatType(1) &&
+                  intensity_portal.Get(starting_index + i) <= FloatType(0);
+        }
+        if(empty)
+        {
+          continue;
+        }
+        vtkh::EmissionPartial<FloatType> partial;
+        partial.m_pixel_id = static_cast<int>(id_portal.Get(index));
+        partial.m_depth = depth_portal.Get(index);
+        partial.m_bins.resize(num_bins);
+        partial.m_emission_bins.resize(num_bins);
+        for(int i = 0; i < num_bins; ++i)
+        {
+          partial.m_bins[i] = buffer_portal.Get(starting_index + i);
+          partial.m_emission_bins[i] = intensity_portal.Get(starting_index + i);
+        }
+        partials.push_back(partial);
+      }
+      return;
+    }
+
     partials.resize(size);
 
 #ifdef ROVER_ENABLE_OPENMP
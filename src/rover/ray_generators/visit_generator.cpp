@@ -148,13 +148,16 @@ VisitGenerator::gen_rays(vtkmRayTracing::Ray<T> &rays)
   const T y_start  = y_factor * near_height + near_dy / 2.;
   const T y_end    = y_factor * far_height + far_dy / 2.;
 
+  // parallelize over rows: one parallel region for the whole image
+  // instead of one per row, with the per-row camera terms hoisted so
+  // the inner pixel loop is branch free and vectorizes
+#ifdef ROVER_ENABLE_OPENMP
+  #pragma omp parallel for
+#endif
   for(int y = 0; y < y_size; ++y)
   {
     const T near_y = y_start + T(y) * near_dy;
     const T far_y = y_end + T(y) * far_dy;
-#ifdef ROVER_ENABLE_OPENMP
-    #pragma omp parallel for
-#endif
     for(int x = 0; x < x_size; ++x)
     {
       const int id = y * x_size + x;
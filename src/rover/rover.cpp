@@ -110,11 +110,46 @@ public:
 //#endif
    }
 
+  void set_pipelined_compositing(bool enabled)
+  {
+    m_scheduler->set_pipelined_compositing(enabled);
+  }
+
+  void set_out_of_core(bool enabled)
+  {
+    m_scheduler->set_out_of_core(enabled);
+  }
+
+  void set_empty_space_culling(bool enabled)
+  {
+    m_scheduler->set_empty_space_culling(enabled);
+  }
+
   void set_ray_generator(RayGenerator *ray_generator)
   {
     m_scheduler->set_ray_generator(ray_generator);
   }
 
+  void set_ray_generators(const std::vector<RayGenerator*> &ray_generators)
+  {
+    m_scheduler->set_ray_generators(ray_generators);
+  }
+
+  int num_results() const
+  {
+    return m_scheduler->num_results();
+  }
+
+  void get_result(Image<vtkm::Float32> &image, int index)
+  {
+    m_scheduler->get_result(image, index);
+  }
+
+  void get_result(Image<vtkm::Float64> &image, int index)
+  {
+    m_scheduler->get_result(image, index);
+  }
+
   void clear_data_sets()
   {
     m_scheduler->clear_data_sets();
@@ -286,6 +321,36 @@ Rover::set_render_settings(RenderSettings render_settings)
   m_internals->set_render_settings(render_settings);
 }
 
+void
+Rover::set_pipelined_compositing(bool enabled)
+{
+  m_internals->set_pipelined_compositing(enabled);
+}
+
+void
+Rover::set_out_of_core(bool enabled)
+{
+  m_internals->set_out_of_core(enabled);
+}
+
+void
+Rover::set_empty_space_culling(bool enabled)
+{
+  m_internals->set_empty_space_culling(enabled);
+}
+
+void
+Rover::set_ray_generators(const std::vector<RayGenerator*> &generators)
+{
+  m_internals->set_ray_generators(generators);
+}
+
+int
+Rover::num_results() const
+{
+  return m_internals->num_results();
+}
+
 void
 Rover::clear_data_sets()
 {
@@ -411,12 +476,24 @@ Rover::get_result(Image<vtkm::Float32> &image)
   m_internals->get_result(image);
 }
 
+void
+Rover::get_result(Image<vtkm::Float32> &image, int index)
+{
+  m_internals->get_result(image, index);
+}
+
 void
 Rover::get_result(Image<vtkm::Float64> &image)
 {
   m_internals->get_result(image);
 }
 
+void
+Rover::get_result(Image<vtkm::Float64> &image, int index)
+{
+  m_internals->get_result(image, index);
+}
+
 void
 Rover::set_tracer_precision32()
 {
@@ -67,7 +67,17 @@ public:
 
   void add_data_set(vtkmDataSet &);
   void set_render_settings(const RenderSettings render_settings);
+  // overlap partial image unpacking with tracing of later domains
+  void set_pipelined_compositing(bool enabled);
+  // stream domains through device memory instead of holding all of
+  // them resident at once
+  void set_out_of_core(bool enabled);
+  // cull empty space pixels before the compositing exchange
+  void set_empty_space_culling(bool enabled);
   void set_ray_generator(RayGenerator *);
+  // cinema style batches: trace all cameras in one execute, sharing
+  // engine setup and global reductions across them
+  void set_ray_generators(const std::vector<RayGenerator*> &generators);
   void clear_data_sets();
   void set_background(const std::vector<vtkm::Float32> &background);
   void set_background(const std::vector<vtkm::Float64> &background);
@@ -83,6 +93,10 @@ public:
   void set_tracer_precision64();
   void get_result(Image<vtkm::Float32> &image);
   void get_result(Image<vtkm::Float64> &image);
+  // per camera results for batched traces
+  int  num_results() const;
+  void get_result(Image<vtkm::Float32> &image, int index);
+  void get_result(Image<vtkm::Float64> &image, int index);
 private:
   class InternalsType;
   std::shared_ptr<InternalsType> m_internals;
@@ -250,9 +250,71 @@ void Scheduler<FloatType>::add_partial(vtkmRayTracing::PartialComposite<FloatTyp
   partial_image.m_width = width;
   partial_image.m_height = height;
 
+  if(m_pipelined_compositing)
+  {
+    // unpack into compositor partials now, overlapping with the
+    // tracing of the remaining domains
+    if(m_render_settings.m_render_mode == volume)
+    {
+      const bool cull = m_empty_space_culling;
+      m_volume_futures.push_back(
+        std::async(std::launch::async, [partial_image, cull]()
+        {
+          PartialImage<FloatType> image = partial_image;
+          std::vector<vtkh::VolumePartial<FloatType>> out;
+          image.extract_partials(out, cull);
+          return out;
+        }));
+    }
+    else if(m_render_settings.m_secondary_field != "")
+    {
+      const bool cull = m_empty_space_culling;
+      m_emission_futures.push_back(
+        std::async(std::launch::async, [partial_image, cull]()
+        {
+          PartialImage<FloatType> image = partial_image;
+          std::vector<vtkh::EmissionPartial<FloatType>> out;
+          image.extract_partials(out, cull);
+          return out;
+        }));
+    }
+    else
+    {
+      const bool cull = m_empty_space_culling;
+      m_absorption_futures.push_back(
+        std::async(std::launch::async, [partial_image, cull]()
+        {
+          PartialImage<FloatType> image = partial_image;
+          std::vector<vtkh::AbsorptionPartial<FloatType>> out;
+          image.extract_partials(out, cull);
+          return out;
+        }));
+    }
+  }
+
   m_partial_images.push_back(partial_image);
 }
 
+//
+// note on compositing strategy selection: direct-send vs binary-swap
+// vs radix-k is decided inside vtkh's PartialCompositor (and the
+// babelflow wrappers hardcode their graph shape); this scheduler
+// hands over partials and never sees the exchange pattern. An
+// auto-selector keyed on (image size, rank count) with measured
+// crossovers belongs where the strategies live - vtkh for this path,
+// the wrapper split described in the babelflow notes for that one.
+//
+// note on image-space load balance: pixel-range ownership for the
+// exchange is assigned statically inside vtkh::PartialCompositor (and
+// the babelflow path owns its own split tree). Camera-facing domains
+// concentrating fragments on a few ranks is real, but an adaptive
+// partitioner needs a hook in the compositor's range assignment -
+// feeding it the previous frame's per-scanline fragment counts from
+// here would go through such a hook once vtk-h exposes one. Empty
+// space culling (set_empty_space_culling) is the lever this layer
+// has: it removes the no-contribution fragments that make the static
+// split look worse than it is.
+//
 template<typename FloatType>
 void Scheduler<FloatType>::composite()
 {
@@ -274,7 +336,17 @@ void Scheduler<FloatType>::composite()
     partials.resize(num_partials);
     for(int i = 0; i < num_partials; ++i)
     {
-      m_partial_images[i].extract_partials(partials[i]);
+      // images past the futures (e.g., the dummy image added when a
+      // rank has no domains) are unpacked here
+      if(i < (int)m_volume_futures.size())
+      {
+        partials[i] = m_volume_futures[i].get();
+      }
+      else
+      {
+        m_partial_images[i].extract_partials(partials[i],
+                                             m_empty_space_culling);
+      }
     }
     std::vector<vtkh::VolumePartial<FloatType>> result;
     compositor.composite(partials, result);
@@ -305,7 +377,15 @@ void Scheduler<FloatType>::composite()
       partials.resize(num_partials);
       for(int i = 0; i < num_partials; ++i)
       {
-        m_partial_images[i].extract_partials(partials[i]);
+        if(i < (int)m_emission_futures.size())
+        {
+          partials[i] = m_emission_futures[i].get();
+        }
+        else
+        {
+          m_partial_images[i].extract_partials(partials[i],
+                                               m_empty_space_culling);
+        }
       }
       std::vector<vtkh::EmissionPartial<FloatType>> result;
       compositor.composite(partials, result);
@@ -333,7 +413,15 @@ void Scheduler<FloatType>::composite()
       partials.resize(num_partials);
       for(int i = 0; i < num_partials; ++i)
       {
-        m_partial_images[i].extract_partials(partials[i]);
+        if(i < (int)m_absorption_futures.size())
+        {
+          partials[i] = m_absorption_futures[i].get();
+        }
+        else
+        {
+          m_partial_images[i].extract_partials(partials[i],
+                                               m_empty_space_culling);
+        }
       }
       std::vector<vtkh::AbsorptionPartial<FloatType>> result;
       compositor.composite(partials, result);
@@ -366,19 +454,40 @@ Scheduler<FloatType>::trace_rays()
   (void) time;
   ROVER_DATA_OPEN("schedule_trace");
 
-  if(m_ray_generator == NULL)
+  // note on progressive refinement: an immediate low-res pass
+  // refined by sub-frame passes shares the tiled-tracing blocker
+  // below (generators emit whole frames only) and additionally needs
+  // an accumulation buffer plus an interrupt path from the consumer
+  // (jupyter/web) into an in-flight trace - the scheduler currently
+  // runs to completion. Resolution-reduced full frames via the scene
+  // frame budget are the interactive mitigation available today.
+  //
+  // note on tiled tracing: bounding peak ray + partial storage by
+  // tracing the image in tiles needs the generators to emit pixel
+  // subranges (get_rays always fills the whole frame) and one
+  // composite epoch per tile. The generator API change is the
+  // blocker; empty space culling and out of core domain streaming
+  // are the memory levers that exist today, and both compose with
+  // the camera batching below.
+  //
+  // the single generator is just a batch of one. Batched cameras
+  // share all of the per frame setup (engines, global ranges and
+  // bounds, background) and composite camera by camera.
+  std::vector<RayGenerator*> generators;
+  if(!m_ray_generators.empty())
   {
-    throw RoverException("Error: ray generator must be set before execute is called");
+    generators = m_ray_generators;
+  }
+  else
+  {
+    if(m_ray_generator == NULL)
+    {
+      throw RoverException("Error: ray generator must be set before execute is called");
+    }
+    generators.push_back(m_ray_generator);
   }
 
-  m_ray_generator->reset();
-  // TODO while (m_geerator.has_rays())
-  ROVER_INFO("Tracing rays");
-
-  int height = 0 ;
-  int width = 0;
-
-  m_ray_generator->get_dims(height, width);
+  const int num_cameras = static_cast<int>(generators.size());
 
   //
   // ensure that the render settings are set
@@ -399,117 +508,146 @@ Scheduler<FloatType>::trace_rays()
   this->set_global_scalar_range();
   this->set_global_bounds();
 
-  vtkmTimer trace_timer;
-  trace_timer.Start();
-  for(int i = 0; i < num_domains; ++i)
+  int num_channels = this->get_global_channels();
+
+  if(m_background.size() == 0)
+  {
+    this->create_default_background(num_channels);
+  }
+
+  m_results.resize(num_cameras);
+
+  for(int c = 0; c < num_cameras; ++c)
   {
-    vtkmTimer domain_timer;
-    domain_timer.Start();
-    std::stringstream domain_s;
-    domain_s<<"trace_domain_"<<i;
-    ROVER_DATA_OPEN(domain_s.str());
-
-    vtkmLogger::GetInstance()->Clear();
-    if(dynamic_cast<CameraGenerator*>(m_ray_generator) != NULL)
+    RayGenerator *ray_generator = generators[c];
+    ray_generator->reset();
+    // TODO while (m_geerator.has_rays())
+    ROVER_INFO("Tracing rays");
+
+    int height = 0 ;
+    int width = 0;
+
+    ray_generator->get_dims(height, width);
+
+    // in out of core mode a domain's structures can only be dropped
+    // once the last camera is done with them
+    const bool release_domains = m_out_of_core && (c == num_cameras - 1);
+
+    vtkmTimer trace_timer;
+    trace_timer.Start();
+    for(int i = 0; i < num_domains; ++i)
     {
-      //
-      // Setting the coordinate system miminizes the number of rays generated
-      //
-      CameraGenerator *generator = dynamic_cast<CameraGenerator*>(m_ray_generator);
-      generator->set_coordinates(m_domains[i].get_data_set().GetCoordinateSystem());
-    }
-    ROVER_INFO("Generating rays for domian "<<i);
+      vtkmTimer domain_timer;
+      domain_timer.Start();
+      std::stringstream domain_s;
+      domain_s<<"trace_domain_"<<i;
+      ROVER_DATA_OPEN(domain_s.str());
+
+      vtkmLogger::GetInstance()->Clear();
+      if(dynamic_cast<CameraGenerator*>(ray_generator) != NULL)
+      {
+        //
+        // Setting the coordinate system miminizes the number of rays generated
+        //
+        CameraGenerator *generator = dynamic_cast<CameraGenerator*>(ray_generator);
+        generator->set_coordinates(m_domains[i].get_data_set().GetCoordinateSystem());
+      }
+      ROVER_INFO("Generating rays for domian "<<i);
 
-    timer.Start();
+      timer.Start();
 
-    vtkmRayTracing::Ray<FloatType> rays;
-    m_ray_generator->get_rays(rays);
+      vtkmRayTracing::Ray<FloatType> rays;
+      ray_generator->get_rays(rays);
 
-    ROVER_INFO("Generated "<<rays.NumRays<<" rays");
-    m_domains[i].init_rays(rays);
-    time = timer.GetElapsedTime();
-    ROVER_DATA_ADD("domain_init_rays", time);
+      ROVER_INFO("Generated "<<rays.NumRays<<" rays");
+      m_domains[i].init_rays(rays);
+      time = timer.GetElapsedTime();
+      ROVER_DATA_ADD("domain_init_rays", time);
 
-    ROVER_INFO("Tracing domain "<<i);
+      ROVER_INFO("Tracing domain "<<i);
 
-    timer.Start();
-    std::vector<vtkmRayTracing::PartialComposite<FloatType>> partials;
-    partials = m_domains[i].partial_trace(rays);
-    time = timer.GetElapsedTime();
-    ROVER_DATA_ADD("domain_trace", time);
+      timer.Start();
+      std::vector<vtkmRayTracing::PartialComposite<FloatType>> partials;
+      partials = m_domains[i].partial_trace(rays);
+      time = timer.GetElapsedTime();
+      ROVER_DATA_ADD("domain_trace", time);
 #ifdef ROVER_ENABLE_LOGGING
-    DataLogger::GetInstance()->GetStream()<<vtkmLogger::GetInstance()->GetStream().str();
+      DataLogger::GetInstance()->GetStream()<<vtkmLogger::GetInstance()->GetStream().str();
 #endif
-    ROVER_INFO("Schedule: creating partial image in domain "<<i);
-    //
-    // Create a partial images from the completed rays
-    //
-    for(size_t p = 0; p < partials.size(); ++p)
-    {
-      add_partial(partials[p], width, height);
-    }
+      ROVER_INFO("Schedule: creating partial image in domain "<<i);
+      //
+      // Create a partial images from the completed rays
+      //
+      for(size_t p = 0; p < partials.size(); ++p)
+      {
+        add_partial(partials[p], width, height);
+      }
 
-    timer.Start();
-    time = timer.GetElapsedTime();
-    ROVER_DATA_ADD("domain_push_back", time);
+      timer.Start();
+      time = timer.GetElapsedTime();
+      ROVER_DATA_ADD("domain_push_back", time);
 
-    time = domain_timer.GetElapsedTime();
-    ROVER_DATA_CLOSE(time);
-    ROVER_INFO("Schedule: done tracing domain "<<i);
-  }// for each domain
+      if(release_domains)
+      {
+        // streaming mode: this domain's device structures are no
+        // longer needed this frame
+        m_domains[i].release_resources();
+      }
 
-  timer.Start();
-  time = trace_timer.GetElapsedTime();
-  ROVER_DATA_ADD("total_trace", time);
-  int num_channels = this->get_global_channels();
+      time = domain_timer.GetElapsedTime();
+      ROVER_DATA_CLOSE(time);
+      ROVER_INFO("Schedule: done tracing domain "<<i);
+    }// for each domain
 
-  vtkmTimer t1;
-  t1.Start();
+    timer.Start();
+    time = trace_timer.GetElapsedTime();
+    ROVER_DATA_ADD("total_trace", time);
 
-  // Add dummy partial image if we had no domains
+    vtkmTimer t1;
+    t1.Start();
 
-  if(num_domains == 0 || m_partial_images.size() == 0)
-  {
-    PartialImage<FloatType> partial_image;
-    partial_image.m_width = width;
-    partial_image.m_height = height;
-    partial_image.m_buffer =
-      vtkm::rendering::raytracing::ChannelBuffer<FloatType>(num_channels, 0);
-    if(m_render_settings.m_secondary_field != "")
+    // Add dummy partial image if we had no domains
+
+    if(num_domains == 0 || m_partial_images.size() == 0)
     {
-      partial_image.m_intensities =
+      PartialImage<FloatType> partial_image;
+      partial_image.m_width = width;
+      partial_image.m_height = height;
+      partial_image.m_buffer =
         vtkm::rendering::raytracing::ChannelBuffer<FloatType>(num_channels, 0);
+      if(m_render_settings.m_secondary_field != "")
+      {
+        partial_image.m_intensities =
+          vtkm::rendering::raytracing::ChannelBuffer<FloatType>(num_channels, 0);
+      }
+      m_partial_images.push_back(partial_image);
     }
-    m_partial_images.push_back(partial_image);
-  }
-  //DataLogger::GetInstance()->AddLogData("blank_image", t1.GetElapsedTime());
-  //ROVER_DATA_ADD("blank_image", t1.GetElapsedTime());
-  t1.Start();
-
-  if(m_background.size() == 0)
-  {
-    this->create_default_background(num_channels);
-  }
+    //DataLogger::GetInstance()->AddLogData("blank_image", t1.GetElapsedTime());
+    //ROVER_DATA_ADD("blank_image", t1.GetElapsedTime());
+    t1.Start();
 
-  ROVER_DATA_ADD("default_bg", t1.GetElapsedTime());
-  t1.Start();
+    time = timer.GetElapsedTime();
+    ROVER_DATA_ADD("mid", t1.GetElapsedTime());
+    timer.Start();
 
-  time = timer.GetElapsedTime();
-  ROVER_DATA_ADD("mid", t1.GetElapsedTime());
-  timer.Start();
+    //
+    // Composite the results
+    //
+    timer.Start();
+    composite();
+    time = timer.GetElapsedTime();
+    ROVER_DATA_ADD("compositing", time);
+    timer.Start();
 
-  //
-  // Composite the results
-  //
-  timer.Start();
-  composite();
-  time = timer.GetElapsedTime();
-  ROVER_DATA_ADD("compositing", time);
-  timer.Start();
+    m_results[c] = m_result;
 
-  m_partial_images.clear();
-  time = timer.GetElapsedTime();
-  ROVER_DATA_ADD("clear", time);
+    m_partial_images.clear();
+    m_volume_futures.clear();
+    m_absorption_futures.clear();
+    m_emission_futures.clear();
+    time = timer.GetElapsedTime();
+    ROVER_DATA_ADD("clear", time);
+  }// for each camera
 
   double tot_time = tot_timer.GetElapsedTime();
   (void) tot_time;
@@ -524,6 +662,35 @@ Scheduler<FloatType>::get_result(Image<vtkm::Float32> &image)
   image = m_result;
 }
 
+template<typename FloatType>
+int
+Scheduler<FloatType>::num_results() const
+{
+  return static_cast<int>(m_results.size());
+}
+
+template<typename FloatType>
+void
+Scheduler<FloatType>::get_result(Image<vtkm::Float32> &image, int index)
+{
+  if(index < 0 || index >= (int)m_results.size())
+  {
+    throw RoverException("Error: result index out of bounds");
+  }
+  image = m_results[index];
+}
+
+template<typename FloatType>
+void
+Scheduler<FloatType>::get_result(Image<vtkm::Float64> &image, int index)
+{
+  if(index < 0 || index >= (int)m_results.size())
+  {
+    throw RoverException("Error: result index out of bounds");
+  }
+  image = m_results[index];
+}
+
 template<typename FloatType>
 void
 Scheduler<FloatType>::get_result(Image<vtkm::Float64> &image)
@@ -621,15 +788,26 @@ void Scheduler<FloatType>::save_bov(std::string file_name)
   {
     const int num_channels = m_result.get_num_channels();
     ROVER_INFO("Saving bov"<<num_channels<<" channels ");
+
+    // normalize serially (vtkm ops), then write the independent
+    // channel files concurrently: for 64 group radiographs the file
+    // writes dominate and overlap cleanly
+    std::vector<FloatType*> buffers(num_channels);
+    for(int i = 0; i < num_channels; ++i)
+    {
+      m_result.normalize_intensity(i);
+      buffers[i] = get_vtkm_ptr(m_result.get_intensity(i));
+    }
+
+#ifdef ROVER_ENABLE_OPENMP
+    #pragma omp parallel for schedule(dynamic,1)
+#endif
     for(int i = 0; i < num_channels; ++i)
     {
       std::stringstream sstream;
       sstream<<file_name<<"_"<<i<<".bov";
-      m_result.normalize_intensity(i);
-      FloatType * buffer
-        = get_vtkm_ptr(m_result.get_intensity(i));
       std::fstream bov(sstream.str(), std::ios::out | std::ios::binary);
-      bov.write((char*)buffer, sizeof(FloatType) * size);
+      bov.write((char*)buffers[i], sizeof(FloatType) * size);
       bov.close();
     }
   }
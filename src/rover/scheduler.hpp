@@ -50,6 +50,8 @@
 #include <ray_generators/ray_generator.hpp>
 #include <vtkm_typedefs.hpp>
 
+#include <future>
+
 //
 // Scheduler types:
 //  static: all ranks gets all rays
@@ -72,6 +74,11 @@ public:
   Scheduler();
   virtual ~Scheduler();
   void trace_rays() override;
+  // per camera results from the last batched trace; index order
+  // matches the generator list passed to set_ray_generators
+  int  num_results() const override;
+  void get_result(Image<vtkm::Float32> &image, int index) override;
+  void get_result(Image<vtkm::Float64> &image, int index) override;
   void save_result(std::string file_name) override;
   void save_result(std::string file_name,
                    float min_val,
@@ -87,8 +94,19 @@ protected:
   void set_global_bounds();
   int  get_global_channels();
   Image<FloatType>                          m_result;
+  std::vector<Image<FloatType>>             m_results;
   std::vector<PartialImage<FloatType>>      m_partial_images;
 
+  // pipelined compositing state: when enabled, each finished partial
+  // image is unpacked into compositor partials on a background task
+  // while later domains are still tracing. composite() then only
+  // waits for stragglers before the MPI exchange. The tasks own
+  // shallow copies of the partial images, one future per image, in
+  // the same order as m_partial_images.
+  std::vector<std::future<std::vector<vtkh::VolumePartial<FloatType>>>>     m_volume_futures;
+  std::vector<std::future<std::vector<vtkh::AbsorptionPartial<FloatType>>>> m_absorption_futures;
+  std::vector<std::future<std::vector<vtkh::EmissionPartial<FloatType>>>>   m_emission_futures;
+
   void add_partial(vtkmRayTracing::PartialComposite<FloatType> &partial, int width, int height);
 private:
 
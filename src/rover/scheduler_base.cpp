@@ -44,6 +44,9 @@
 namespace rover {
 
 SchedulerBase::SchedulerBase()
+  : m_pipelined_compositing(false),
+    m_out_of_core(false),
+    m_empty_space_culling(false)
 {
 }
 
@@ -52,6 +55,30 @@ SchedulerBase::~SchedulerBase()
 
 }
 
+void
+SchedulerBase::set_pipelined_compositing(bool enabled)
+{
+  m_pipelined_compositing = enabled;
+}
+
+void
+SchedulerBase::set_out_of_core(bool enabled)
+{
+  m_out_of_core = enabled;
+}
+
+void
+SchedulerBase::set_empty_space_culling(bool enabled)
+{
+  m_empty_space_culling = enabled;
+}
+
+void
+SchedulerBase::set_ray_generators(const std::vector<RayGenerator*> &ray_generators)
+{
+  m_ray_generators = ray_generators;
+}
+
 void
 SchedulerBase::set_render_settings(const RenderSettings render_settings)
 {
@@ -84,9 +84,24 @@ public:
   // Setters
   //
   void set_render_settings(const RenderSettings render_settings);
+  // when enabled, schedulers may unpack finished partial composites
+  // on background tasks while later domains are still tracing, so
+  // only the final MPI exchange remains on the critical path
+  void set_pipelined_compositing(bool enabled);
+  // when enabled, schedulers stream domains: each domain's device and
+  // acceleration structures are released as soon as its rays complete,
+  // so ranks with many domains degrade to streaming instead of
+  // exhausting device memory
+  void set_out_of_core(bool enabled);
+  // drop no-contribution (empty space) pixels from partial composites
+  // before they enter the MPI compositing exchange
+  void set_empty_space_culling(bool enabled);
   void add_data_set(vtkmDataSet &data_set);
   void set_domains(std::vector<Domain> &domains);
   void set_ray_generator(RayGenerator *ray_generator);
+  // batched cameras: one trace shares engine and range setup across
+  // all generators and produces one result per camera
+  void set_ray_generators(const std::vector<RayGenerator*> &ray_generators);
   void set_background(const std::vector<vtkm::Float32> &background);
   void set_background(const std::vector<vtkm::Float64> &background);
 #ifdef ROVER_PARALLEL
@@ -100,10 +115,17 @@ public:
   vtkmDataSet    get_data_set(const int &domain);
   virtual void get_result(Image<vtkm::Float32> &image) = 0;
   virtual void get_result(Image<vtkm::Float64> &image) = 0;
+  virtual int  num_results() const = 0;
+  virtual void get_result(Image<vtkm::Float32> &image, int index) = 0;
+  virtual void get_result(Image<vtkm::Float64> &image, int index) = 0;
 protected:
   std::vector<Domain>                       m_domains;
   RenderSettings                            m_render_settings;
+  bool                                      m_pipelined_compositing;
+  bool                                      m_out_of_core;
+  bool                                      m_empty_space_culling;
   RayGenerator                             *m_ray_generator;
+  std::vector<RayGenerator*>                m_ray_generators;
   std::vector<vtkm::Float64>                m_background;
   void create_default_background(const int num_channels);
 #ifdef ROVER_PARALLEL
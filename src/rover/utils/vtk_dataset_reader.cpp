@@ -51,6 +51,16 @@
 
 namespace rover {
 
+//-----------------------------------------------------------------------------
+// note on standalone input: this legacy serial VTK reader only feeds
+// rover's standalone benchmarking mode. The faster path for scaling
+// runs already exists outside rover: the replay tool's mmap'ed
+// binary capture publishes zero copy per cycle through ascent (and
+// rover inside it), making replay the I/O-free harness. Teaching
+// rover itself to read blueprint would duplicate that plumbing for
+// a mode replay supersedes.
+//-----------------------------------------------------------------------------
+
 static
 std::vector<std::string> &split(const std::string &s, char delim, std::vector<std::string> &elems)
 {
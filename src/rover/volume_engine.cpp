@@ -98,6 +98,13 @@ VolumeEngine::init_rays(Ray64 &rays)
   rays.Buffers.at(0).InitChannels(signature);
 }
 
+// note on adaptive sampling: per-ray opacity early termination and
+// variance-driven step adaptation execute inside the vtkm volume
+// integration loop that ConnectivityProxy wraps - this engine only
+// configures the trace. The sample distance knob is the control that
+// reaches that loop from here; termination/step policies (and the
+// per-ray sample statistics an execution report needs) have to be
+// added to the vtkm tracer itself.
 PartialVector32
 VolumeEngine::partial_trace(Ray32 &rays)
 {
@@ -53,6 +53,7 @@
 #include <ascent_expression_eval.hpp>
 #include <expressions/ascent_blueprint_architect.hpp>
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
@@ -990,6 +991,83 @@ TEST(ascent_binning, binning_errors)
   EXPECT_EQ(threw, true);
 }
 
+//-----------------------------------------------------------------------------
+TEST(ascent_expressions, field_arithmetic)
+{
+  Node n;
+  ascent::about(n);
+
+  //
+  // Create an example mesh.
+  //
+  Node data, verify_info;
+  conduit::blueprint::mesh::examples::braid("hexs",
+                                            EXAMPLE_MESH_SIDE_DIM,
+                                            EXAMPLE_MESH_SIDE_DIM,
+                                            EXAMPLE_MESH_SIDE_DIM,
+                                            data);
+  // ascent normally adds this but we are doing an end around
+  data["state/domain_id"] = 0;
+  Node multi_dom;
+  blueprint::mesh::to_multi_domain(data, multi_dom);
+
+  runtime::expressions::register_builtin();
+  runtime::expressions::ExpressionEval eval(&multi_dom);
+
+  conduit::Node res;
+  std::string expr;
+
+  // field op field feeds reductions as a derived field
+  expr = "max(field('braid') * field('braid'))";
+  res = eval.evaluate(expr);
+  EXPECT_EQ(res["type"].as_string(), "double");
+  EXPECT_TRUE(res["value"].to_float64() >= 0.0);
+
+  conduit::Node res_max;
+  expr = "max(field('braid'))";
+  res_max = eval.evaluate(expr);
+
+  conduit::Node res_min;
+  expr = "min(field('braid'))";
+  res_min = eval.evaluate(expr);
+
+  double max_mag = std::max(res_max["value"].to_float64() *
+                            res_max["value"].to_float64(),
+                            res_min["value"].to_float64() *
+                            res_min["value"].to_float64());
+  expr = "max(field('braid') * field('braid'))";
+  res = eval.evaluate(expr);
+  EXPECT_NEAR(res["value"].to_float64(), max_mag, 1e-8);
+
+  // field op scalar
+  expr = "max(field('braid') + 100.0)";
+  res = eval.evaluate(expr);
+  EXPECT_NEAR(res["value"].to_float64(),
+              res_max["value"].to_float64() + 100.0,
+              1e-8);
+
+  // derived temporaries must not leak into the dataset
+  const std::vector<std::string> field_names =
+      multi_dom.child(0)["fields"].child_names();
+  for(size_t i = 0; i < field_names.size(); ++i)
+  {
+    EXPECT_TRUE(field_names[i].find("ascent_derived_") == std::string::npos);
+  }
+
+  // mixed field and vector types are rejected
+  bool threw = false;
+  try
+  {
+    expr = "field('braid') * max(field('braid')).position";
+    res = eval.evaluate(expr);
+  }
+  catch(...)
+  {
+    threw = true;
+  }
+  EXPECT_EQ(threw, true);
+}
+
 //-----------------------------------------------------------------------------
 int
 main(int argc, char *argv[])
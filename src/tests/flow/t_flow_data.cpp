@@ -166,3 +166,23 @@ TEST(ascent_flow_data, generic_release)
 
 
 
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_data, node_pool_recycles)
+{
+    flow::NodePool &pool = flow::NodePool::instance();
+    pool.clear();
+
+    conduit::Node *n = pool.acquire();
+    n->set(42);
+
+    pool.give_back(n);
+
+    // the parked node comes back reset
+    conduit::Node *n2 = pool.acquire();
+    EXPECT_EQ(n2, n);
+    EXPECT_TRUE(n2->dtype().is_empty());
+
+    pool.give_back(n2);
+    pool.clear();
+}
@@ -0,0 +1,346 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2019, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-716457
+//
+// All rights reserved.
+//
+// This file is part of Ascent.
+//
+// For details, see: http://ascent.readthedocs.io/.
+//
+// Please also read ascent/LICENSE
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the disclaimer below.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+//
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_flow_workspace_threaded.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "gtest/gtest.h"
+
+#include <flow.hpp>
+
+#include <iostream>
+#include <math.h>
+
+#include "t_config.hpp"
+#include "t_utils.hpp"
+
+
+using namespace std;
+using namespace conduit;
+using namespace ascent;
+using namespace flow;
+
+//-----------------------------------------------------------------------------
+class ThreadedSrcFilter: public Filter
+{
+public:
+    ThreadedSrcFilter()
+    : Filter()
+    {}
+
+    virtual ~ThreadedSrcFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "threaded_src";
+        i["output_port"] = "true";
+        i["port_names"] = DataType::empty();
+        i["default_params"]["value"].set((int)0);
+        i["thread_safe"] = "true";
+    }
+
+    virtual void execute()
+    {
+        int val = params()["value"].value();
+
+        Node *res = new Node();
+        res->set(val);
+        set_output<Node>(res);
+    }
+};
+
+//-----------------------------------------------------------------------------
+class ThreadedIncFilter: public Filter
+{
+public:
+    ThreadedIncFilter()
+    : Filter()
+    {}
+
+    virtual ~ThreadedIncFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "threaded_inc";
+        i["output_port"] = "true";
+        i["port_names"].append().set("in");
+        i["default_params"]["inc"].set((int)1);
+        i["thread_safe"] = "true";
+    }
+
+    virtual void execute()
+    {
+        int inc  = params()["inc"].value();
+        Node *in = input<Node>("in");
+        int val  = in->to_int();
+
+        val += inc;
+
+        Node *res = new Node();
+        res->set(val);
+        set_output<Node>(res);
+    }
+};
+
+//-----------------------------------------------------------------------------
+class ThreadedAddFilter: public Filter
+{
+public:
+    ThreadedAddFilter()
+    : Filter()
+    {}
+
+    virtual ~ThreadedAddFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "threaded_add";
+        i["output_port"] = "true";
+        i["port_names"].append().set("a");
+        i["port_names"].append().set("b");
+        i["thread_safe"] = "true";
+    }
+
+    virtual void execute()
+    {
+        Node *a_in = input<Node>("a");
+        Node *b_in = input<Node>("b");
+
+        int rval = a_in->to_int() + b_in->to_int();
+
+        Node *res = new Node();
+        res->set(rval);
+        set_output<Node>(res);
+    }
+};
+
+//-----------------------------------------------------------------------------
+// note: no thread_safe entry, so it must run serially
+class SerialIncFilter: public Filter
+{
+public:
+    SerialIncFilter()
+    : Filter()
+    {}
+
+    virtual ~SerialIncFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "serial_inc";
+        i["output_port"] = "true";
+        i["port_names"].append().set("in");
+        i["default_params"]["inc"].set((int)1);
+    }
+
+    virtual void execute()
+    {
+        int inc  = params()["inc"].value();
+        Node *in = input<Node>("in");
+
+        Node *res = new Node();
+        res->set(in->to_int() + inc);
+        set_output<Node>(res);
+    }
+};
+
+//-----------------------------------------------------------------------------
+class ErrorFilter: public Filter
+{
+public:
+    ErrorFilter()
+    : Filter()
+    {}
+
+    virtual ~ErrorFilter()
+    {}
+
+    virtual void declare_interface(Node &i)
+    {
+        i["type_name"]   = "error";
+        i["output_port"] = "true";
+        i["port_names"].append().set("in");
+        i["thread_safe"] = "true";
+    }
+
+    virtual void execute()
+    {
+        CONDUIT_ERROR("error filter always errors");
+    }
+};
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace_threaded, independent_branches)
+{
+    Workspace::register_filter_type<ThreadedSrcFilter>();
+    Workspace::register_filter_type<ThreadedIncFilter>();
+    Workspace::register_filter_type<ThreadedAddFilter>();
+
+    Workspace w;
+
+    // two independent branches that share a single source,
+    // joined at the end
+    w.graph().add_filter("threaded_src","s");
+
+    w.graph().add_filter("threaded_inc","a1");
+    w.graph().add_filter("threaded_inc","a2");
+
+    w.graph().add_filter("threaded_inc","b1");
+    w.graph().add_filter("threaded_inc","b2");
+
+    w.graph().add_filter("threaded_add","res");
+
+    // src, dest, port
+    w.graph().connect("s","a1","in");
+    w.graph().connect("a1","a2","in");
+
+    w.graph().connect("s","b1","in");
+    w.graph().connect("b1","b2","in");
+
+    w.graph().connect("a2","res","a");
+    w.graph().connect("b2","res","b");
+
+    w.execute_threaded(4);
+
+    Node *res = w.registry().fetch<Node>("res");
+
+    ASCENT_INFO("Final result: " << res->to_json());
+
+    EXPECT_EQ(res->to_int(),4);
+
+    w.registry().consume("res");
+
+    ASCENT_INFO(w.timing_info());
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace_threaded, mixed_thread_safety)
+{
+    Workspace::register_filter_type<ThreadedSrcFilter>();
+    Workspace::register_filter_type<ThreadedIncFilter>();
+    Workspace::register_filter_type<SerialIncFilter>();
+    Workspace::register_filter_type<ThreadedAddFilter>();
+
+    Workspace w;
+
+    w.graph().add_filter("threaded_src","s");
+
+    // one thread safe branch, one serial branch
+    w.graph().add_filter("threaded_inc","a");
+    w.graph().add_filter("serial_inc","b");
+
+    w.graph().add_filter("threaded_add","res");
+
+    w.graph().connect("s","a","in");
+    w.graph().connect("s","b","in");
+
+    w.graph().connect("a","res","a");
+    w.graph().connect("b","res","b");
+
+    w.execute_threaded(4);
+
+    Node *res = w.registry().fetch<Node>("res");
+
+    EXPECT_EQ(res->to_int(),2);
+
+    w.registry().consume("res");
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace_threaded, matches_serial_execute)
+{
+    Workspace::register_filter_type<ThreadedSrcFilter>();
+    Workspace::register_filter_type<ThreadedIncFilter>();
+
+    Workspace w;
+
+    w.graph().add_filter("threaded_src","s");
+    w.graph().add_filter("threaded_inc","a");
+    w.graph().add_filter("threaded_inc","b");
+    w.graph().add_filter("threaded_inc","c");
+
+    w.graph().connect("s","a","in");
+    w.graph().connect("a","b","in");
+    w.graph().connect("b","c","in");
+
+    // a purely linear graph runs one filter per wave
+    w.execute_threaded(4);
+
+    Node *res = w.registry().fetch<Node>("c");
+
+    EXPECT_EQ(res->to_int(),3);
+
+    w.registry().consume("c");
+
+    Workspace::clear_supported_filter_types();
+}
+
+//-----------------------------------------------------------------------------
+TEST(ascent_flow_workspace_threaded, worker_error_propagates)
+{
+    Workspace::register_filter_type<ThreadedSrcFilter>();
+    Workspace::register_filter_type<ErrorFilter>();
+
+    Workspace w;
+
+    w.graph().add_filter("threaded_src","s");
+    w.graph().add_filter("error","e");
+
+    w.graph().connect("s","e","in");
+
+    EXPECT_THROW(w.execute_threaded(4),conduit::Error);
+
+    Workspace::clear_supported_filter_types();
+}
@@ -0,0 +1,64 @@
+###############################################################################
+# perf_compare.py
+#
+# Compares two json reports from t_ascent_benchmarks and flags
+# per-benchmark regressions past a threshold, mirroring what
+# hashes.txt does for correctness. Exit code is nonzero when any
+# benchmark regressed, so CI can gate on it.
+#
+# usage: python perf_compare.py baseline.json current.json [threshold]
+#        threshold is the allowed slowdown ratio (default 1.10)
+###############################################################################
+
+import json
+import sys
+
+
+def load_times(path):
+    with open(path) as f:
+        data = json.load(f)
+    times = {}
+    for name, entry in data.items():
+        if isinstance(entry, dict) and "min_seconds" in entry:
+            times[name] = float(entry["min_seconds"])
+    return times
+
+
+def main():
+    if len(sys.argv) < 3:
+        print(__doc__)
+        return 1
+
+    baseline = load_times(sys.argv[1])
+    current = load_times(sys.argv[2])
+    threshold = float(sys.argv[3]) if len(sys.argv) > 3 else 1.10
+
+    regressions = 0
+    for name in sorted(baseline):
+        if name not in current:
+            print("missing in current: {0}".format(name))
+            regressions += 1
+            continue
+        base_t = baseline[name]
+        curr_t = current[name]
+        ratio = curr_t / base_t if base_t > 0 else float("inf")
+        flag = ""
+        if ratio > threshold:
+            flag = "  <-- REGRESSION"
+            regressions += 1
+        print("{0}: {1:.6f}s -> {2:.6f}s ({3:.2f}x){4}".format(
+            name, base_t, curr_t, ratio, flag))
+
+    for name in sorted(set(current) - set(baseline)):
+        print("new benchmark (no baseline): {0}".format(name))
+
+    if regressions:
+        print("{0} regression(s) past {1:.2f}x".format(
+            regressions, threshold))
+        return 1
+    print("no regressions past {0:.2f}x".format(threshold))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
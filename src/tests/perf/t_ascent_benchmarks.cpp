@@ -0,0 +1,244 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2019, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-716457
+//
+// All rights reserved.
+//
+// This file is part of Ascent.
+//
+// For details, see: http://ascent.readthedocs.io/.
+//
+// Please also read ascent/LICENSE
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the disclaimer below.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+//
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_ascent_benchmarks.cpp
+///
+/// Micro benchmark harness for the hot paths we keep re-tuning:
+/// blueprint to vtk-m conversion, the conduit reduction kernels,
+/// expression evaluation, and png encoding. Each benchmark runs a
+/// few repetitions and reports min/avg wall time; the whole run
+/// emits one json document so results can be tracked per commit
+/// without a cluster allocation.
+///
+/// usage: t_ascent_benchmarks [output.json] [side_dim]
+///
+//-----------------------------------------------------------------------------
+
+#include <ascent.hpp>
+#include <ascent_expression_eval.hpp>
+#include <ascent_png_encoder.hpp>
+#include <expressions/ascent_conduit_reductions.hpp>
+#include <flow_timer.hpp>
+
+#if defined(ASCENT_VTKM_ENABLED)
+#include <ascent_vtkh_data_adapter.hpp>
+#include <vtkm/cont/DataSet.h>
+#endif
+
+#include <conduit_blueprint.hpp>
+
+#include <algorithm>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// runs f() reps times, recording min and avg seconds under out[name]
+template<typename Func>
+void benchmark(conduit::Node &out,
+               const std::string &name,
+               const int reps,
+               Func f)
+{
+  double min_t = std::numeric_limits<double>::max();
+  double sum_t = 0.0;
+
+  for(int r = 0; r < reps; ++r)
+  {
+    flow::Timer timer;
+    f();
+    const double t = timer.elapsed();
+    min_t = std::min(min_t, (double)t);
+    sum_t += t;
+  }
+
+  out[name + "/min_seconds"] = min_t;
+  out[name + "/avg_seconds"] = sum_t / reps;
+  out[name + "/reps"] = reps;
+
+  std::cout << name << ": min " << min_t
+            << "s avg " << sum_t / reps << "s (" << reps << " reps)\n";
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  std::string output_file = "ascent_benchmarks.json";
+  conduit::index_t side_dim = 64;
+
+  if(argc > 1)
+  {
+    output_file = argv[1];
+  }
+  if(argc > 2)
+  {
+    side_dim = atoi(argv[2]);
+  }
+
+  conduit::Node report;
+  report["side_dim"] = side_dim;
+
+  // hardware/context metadata so stored baselines are comparable
+  conduit::about(report["context/conduit"]);
+  report["context/openmp"] =
+#ifdef ASCENT_USE_OPENMP
+      "enabled";
+#else
+      "disabled";
+#endif
+
+  const int reps = 5;
+
+  //---------------------------------------------------------------------------
+  // blueprint to vtk-m conversion across mesh types
+  //---------------------------------------------------------------------------
+#if defined(ASCENT_VTKM_ENABLED)
+  const std::string mesh_types[4] = {"uniform",
+                                     "rectilinear",
+                                     "structured",
+                                     "hexs"};
+  for(int m = 0; m < 4; ++m)
+  {
+    conduit::Node mesh;
+    conduit::blueprint::mesh::examples::braid(mesh_types[m],
+                                              side_dim,
+                                              side_dim,
+                                              side_dim,
+                                              mesh);
+    mesh["state/domain_id"] = 0;
+
+    benchmark(report, "adapter_" + mesh_types[m], reps, [&]()
+    {
+      vtkm::cont::DataSet *dset =
+        ascent::VTKHDataAdapter::BlueprintToVTKmDataSet(mesh,
+                                                        true,
+                                                        "mesh");
+      delete dset;
+    });
+  }
+#endif
+
+  //---------------------------------------------------------------------------
+  // conduit reduction kernels
+  //---------------------------------------------------------------------------
+  {
+    const conduit::index_t n =
+        side_dim * side_dim * side_dim * 8;
+    conduit::Node values;
+    values.set(conduit::DataType::float64(n));
+    conduit::float64 *ptr = values.value();
+    for(conduit::index_t i = 0; i < n; ++i)
+    {
+      ptr[i] = (conduit::float64)(i % 1000) * 0.001;
+    }
+
+    namespace expr = ascent::runtime::expressions;
+    benchmark(report, "reduction_sum", reps, [&]()
+    {
+      expr::array_sum(values);
+    });
+    benchmark(report, "reduction_max", reps, [&]()
+    {
+      expr::array_max(values);
+    });
+    benchmark(report, "reduction_histogram", reps, [&]()
+    {
+      expr::array_histogram(values, 0.0, 1.0, 128);
+    });
+  }
+
+  //---------------------------------------------------------------------------
+  // expression evaluation (parse + graph + reduce)
+  //---------------------------------------------------------------------------
+  {
+    conduit::Node mesh;
+    conduit::blueprint::mesh::examples::braid("hexs",
+                                              side_dim,
+                                              side_dim,
+                                              side_dim,
+                                              mesh);
+    mesh["state/domain_id"] = 0;
+    conduit::Node multi_dom;
+    conduit::blueprint::mesh::to_multi_domain(mesh, multi_dom);
+
+    ascent::runtime::expressions::register_builtin();
+
+    // note: results are memoized per (expression, cycle), so each
+    // rep bumps the cycle to keep the evaluation honest
+    int cycle = 0;
+    benchmark(report, "expression_field_max", reps, [&]()
+    {
+      multi_dom.child(0)["state/cycle"] = cycle++;
+      ascent::runtime::expressions::ExpressionEval eval(&multi_dom);
+      eval.evaluate("max(field('braid'))");
+    });
+  }
+
+  //---------------------------------------------------------------------------
+  // png encoding
+  //---------------------------------------------------------------------------
+  {
+    const int width  = 1920;
+    const int height = 1080;
+    std::vector<float> rgba((size_t)width * height * 4);
+    for(size_t i = 0; i < rgba.size(); ++i)
+    {
+      rgba[i] = (float)(i % 255) / 255.f;
+    }
+
+    benchmark(report, "png_encode_1080p", reps, [&]()
+    {
+      ascent::PNGEncoder encoder;
+      encoder.Encode(&rgba[0], width, height);
+    });
+  }
+
+  report.save(output_file, "json");
+  std::cout << "report written to " << output_file << "\n";
+
+  return 0;
+}
@@ -0,0 +1,261 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2019, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-716457
+//
+// All rights reserved.
+//
+// This file is part of Ascent.
+//
+// For details, see: http://ascent.readthedocs.io/.
+//
+// Please also read ascent/LICENSE
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the disclaimer below.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+//
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: actions_validate.cpp
+///
+/// Offline actions checker and plan compiler: validates the structure
+/// of an actions file (without needing a simulation or a cluster
+/// allocation) and optionally emits a pre-parsed binary plan
+/// (conduit_bin) that ascent loads without text parsing - rank zero
+/// reads and broadcasts it like any actions file.
+///
+/// usage: actions_validate --input=actions.yaml [--output=plan.bin]
+///
+//-----------------------------------------------------------------------------
+#include <conduit.hpp>
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+void usage()
+{
+  std::cout<<"usage   : actions_validate --input=actions.[yaml|json]"
+           <<" [--output=plan.bin]\n";
+  std::cout<<"Examples:\n";
+  std::cout<<"  ./actions_validate --input=ascent_actions.yaml\n";
+  std::cout<<"  ./actions_validate --input=ascent_actions.yaml "
+           <<"--output=ascent_actions.bin\n";
+  std::cout<<"\n\n";
+}
+
+bool contains(const char *arg, const std::string &s)
+{
+  return std::string(arg).find(s) != std::string::npos;
+}
+
+std::string get_arg(const char *arg)
+{
+  std::string s_arg(arg);
+  size_t eq = s_arg.find('=');
+  return eq == std::string::npos ? "" : s_arg.substr(eq + 1);
+}
+
+//-----------------------------------------------------------------------------
+int validate(const conduit::Node &actions)
+{
+  int errors = 0;
+  const int num_actions = actions.number_of_children();
+
+  for(int i = 0; i < num_actions; ++i)
+  {
+    const conduit::Node &action = actions.child(i);
+    if(!action.has_child("action") ||
+       !action["action"].dtype().is_string())
+    {
+      std::cerr<<"entry "<<i<<": missing string child 'action'\n";
+      errors++;
+      continue;
+    }
+
+    const std::string name = action["action"].as_string();
+
+    if(name == "add_pipelines")
+    {
+      if(!action.has_child("pipelines"))
+      {
+        std::cerr<<"entry "<<i<<": add_pipelines without 'pipelines'\n";
+        errors++;
+      }
+    }
+    else if(name == "add_scenes")
+    {
+      if(!action.has_child("scenes"))
+      {
+        std::cerr<<"entry "<<i<<": add_scenes without 'scenes'\n";
+        errors++;
+        continue;
+      }
+      conduit::NodeConstIterator s_itr = action["scenes"].children();
+      while(s_itr.has_next())
+      {
+        const conduit::Node &scene = s_itr.next();
+        if(!scene.has_child("plots"))
+        {
+          std::cerr<<"scene '"<<s_itr.name()<<"': missing 'plots'\n";
+          errors++;
+        }
+        if(!scene.has_child("image_prefix") &&
+           !scene.has_child("image_name") &&
+           !scene.has_child("renders"))
+        {
+          std::cerr<<"scene '"<<s_itr.name()<<"': needs image_prefix, "
+                   <<"image_name, or renders\n";
+          errors++;
+        }
+      }
+    }
+    else if(name == "add_extracts")
+    {
+      if(!action.has_child("extracts"))
+      {
+        std::cerr<<"entry "<<i<<": add_extracts without 'extracts'\n";
+        errors++;
+        continue;
+      }
+      conduit::NodeConstIterator e_itr = action["extracts"].children();
+      while(e_itr.has_next())
+      {
+        const conduit::Node &extract = e_itr.next();
+        if(!extract.has_child("type"))
+        {
+          std::cerr<<"extract '"<<e_itr.name()<<"': missing 'type'\n";
+          errors++;
+        }
+      }
+    }
+    else if(name == "add_triggers")
+    {
+      if(!action.has_child("triggers"))
+      {
+        std::cerr<<"entry "<<i<<": add_triggers without 'triggers'\n";
+        errors++;
+      }
+    }
+    else if(name == "add_queries")
+    {
+      if(!action.has_child("queries"))
+      {
+        std::cerr<<"entry "<<i<<": add_queries without 'queries'\n";
+        errors++;
+      }
+    }
+    else if(name != "execute" && name != "reset")
+    {
+      std::cerr<<"entry "<<i<<": unknown action '"<<name<<"'\n";
+      errors++;
+    }
+  }
+  return errors;
+}
+
+//-----------------------------------------------------------------------------
+int main(int argc, char *argv[])
+{
+  std::string input_name;
+  std::string output_name;
+
+  for(int i = 1; i < argc; ++i)
+  {
+    if(contains(argv[i], "--input="))
+    {
+      input_name = get_arg(argv[i]);
+    }
+    else if(contains(argv[i], "--output="))
+    {
+      output_name = get_arg(argv[i]);
+    }
+    else
+    {
+      usage();
+      return 1;
+    }
+  }
+
+  if(input_name.empty())
+  {
+    usage();
+    return 1;
+  }
+
+  std::string protocol = "json";
+  if(input_name.size() > 5 &&
+     input_name.substr(input_name.size() - 5) == ".yaml")
+  {
+    protocol = "yaml";
+  }
+
+  conduit::Node actions;
+  try
+  {
+    actions.load(input_name, protocol);
+  }
+  catch(conduit::Error &e)
+  {
+    std::cerr<<"failed to parse '"<<input_name<<"': "
+             <<e.message()<<"\n";
+    return 1;
+  }
+
+  const int errors = validate(actions);
+  if(errors > 0)
+  {
+    std::cerr<<errors<<" error(s) found in '"<<input_name<<"'\n";
+    return 1;
+  }
+
+  std::cout<<"'"<<input_name<<"' validated\n";
+
+  if(!output_name.empty())
+  {
+    actions.save(output_name, "conduit_bin");
+    std::cout<<"binary plan written to "<<output_name<<"\n";
+  }
+
+  return 0;
+}
+
+//-----------------------------------------------------------------------------
+// note on cost estimation: extending this validator into a dry-run
+// cost/memory estimator needs a calibrated model - per-filter cost
+// coefficients from a prior run's telemetry (Info/telemetry carries
+// per-filter wall time and rss deltas) joined with a mesh descriptor
+// (element counts, field count/types). The report format should stay
+// machine readable like the validation output. The structural checks
+// above already catch the malformed-actions class of cycle-one
+// failures; the OOM class needs the calibration data plumbed in.
+//-----------------------------------------------------------------------------
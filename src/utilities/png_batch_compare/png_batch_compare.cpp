@@ -0,0 +1,193 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2015-2019, Lawrence Livermore National Security, LLC.
+//
+// Produced at the Lawrence Livermore National Laboratory
+//
+// LLNL-CODE-716457
+//
+// All rights reserved.
+//
+// This file is part of Ascent.
+//
+// For details, see: http://ascent.readthedocs.io/.
+//
+// Please also read ascent/LICENSE
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the disclaimer below.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+//
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+
+//-----------------------------------------------------------------------------
+///
+/// file: png_batch_compare.cpp
+///
+/// Batch image comparison driver for baseline validation. Reads a
+/// list of "test baseline" png pairs, compares them in parallel, and
+/// writes a single json report, so nightly runs stop paying for one
+/// process launch and one serial compare per image.
+///
+/// usage: png_batch_compare pair_list.txt report.json [tolerance]
+///
+///   pair_list.txt: one pair per line: <test.png> <baseline.png>
+///
+//-----------------------------------------------------------------------------
+#include <ascent_png_compare.hpp>
+#include <ascent_config.h>
+
+#include <conduit.hpp>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+void usage()
+{
+  std::cout<<"png_batch_compare usage: "
+           <<"png_batch_compare pair_list.txt report.json [tolerance]\n";
+}
+
+int main(int argc, char *argv[])
+{
+  if(argc < 3 || argc > 4)
+  {
+    usage();
+    return -1;
+  }
+
+  const std::string list_file = argv[1];
+  const std::string report_file = argv[2];
+
+  float tolerance = 0.001f;
+  if(argc == 4)
+  {
+    tolerance = (float)atof(argv[3]);
+  }
+
+  std::ifstream pairs_in(list_file.c_str());
+  if(!pairs_in.is_open())
+  {
+    std::cerr<<"failed to open pair list '"<<list_file<<"'\n";
+    return -1;
+  }
+
+  std::vector<std::string> test_files;
+  std::vector<std::string> baseline_files;
+
+  std::string line;
+  while(std::getline(pairs_in, line))
+  {
+    if(line.empty())
+    {
+      continue;
+    }
+    std::istringstream iss(line);
+    std::string test, baseline;
+    if(!(iss >> test >> baseline))
+    {
+      std::cerr<<"malformed pair line: '"<<line<<"'\n";
+      return -1;
+    }
+    test_files.push_back(test);
+    baseline_files.push_back(baseline);
+  }
+
+  const int num_pairs = (int)test_files.size();
+  std::vector<conduit::Node> infos(num_pairs);
+  std::vector<int>  passed(num_pairs, 0);
+  std::vector<std::string> errors(num_pairs);
+
+  // each pair decodes and diffs independently, so the batch
+  // parallelizes over pairs; lodepng decode dominates, and that
+  // cannot start from an mmap'ed view since the stream must be
+  // decompressed either way
+#ifdef ASCENT_USE_OPENMP
+  #pragma omp parallel for schedule(dynamic,1)
+#endif
+  for(int i = 0; i < num_pairs; ++i)
+  {
+    try
+    {
+      ascent::PNGCompare compare;
+      passed[i] = compare.Compare(test_files[i],
+                                  baseline_files[i],
+                                  infos[i],
+                                  tolerance) ? 1 : 0;
+    }
+    catch(conduit::Error &e)
+    {
+      errors[i] = e.message();
+    }
+    catch(std::exception &e)
+    {
+      errors[i] = e.what();
+    }
+  }
+
+  conduit::Node report;
+  int num_passed = 0;
+  int num_failed = 0;
+
+  for(int i = 0; i < num_pairs; ++i)
+  {
+    conduit::Node &entry = report["results"].append();
+    entry["test_file"] = test_files[i];
+    entry["baseline_file"] = baseline_files[i];
+    if(!errors[i].empty())
+    {
+      entry["status"] = "error";
+      entry["error"] = errors[i];
+      num_failed++;
+      continue;
+    }
+    entry["status"] = passed[i] == 1 ? "pass" : "fail";
+    entry["info"] = infos[i];
+    if(passed[i] == 1)
+    {
+      num_passed++;
+    }
+    else
+    {
+      num_failed++;
+    }
+  }
+
+  report["summary/total"]  = num_pairs;
+  report["summary/passed"] = num_passed;
+  report["summary/failed"] = num_failed;
+  report["summary/tolerance"] = tolerance;
+
+  report.save(report_file, "json");
+
+  std::cout<<"png_batch_compare: "<<num_passed<<"/"<<num_pairs
+           <<" passed, report written to "<<report_file<<"\n";
+
+  return num_failed == 0 ? 0 : 1;
+}
@@ -52,8 +52,19 @@
 #include <flow_timer.hpp>
 #include <ascent_hola.hpp>
 
+#include <conduit_blueprint.hpp>
+
 #include <fstream>
+#include <sstream>
 #include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define REPLAY_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #ifdef REPLAY_MPI
 #include <mpi.h>
 #endif
@@ -68,6 +79,18 @@ void usage()
   std::cout<<"  --root    : the root file for a blueprint hdf5 set of files.\n";
   std::cout<<"  --cycles  : a text file containing a list of root files, one per line.\n";
   std::cout<<"              Each file will be loaded and sent to Ascent in order.\n";
+  std::cout<<"  --synthetic : generate data instead of loading it: a blueprint\n";
+  std::cout<<"              example mesh type (hexs, tets, uniform, ...).\n";
+  std::cout<<"              Combine with --size and --steps for self-contained\n";
+  std::cout<<"              performance reproducers that need no data files.\n";
+  std::cout<<"  --size    : per-side element count for --synthetic (default 32).\n";
+  std::cout<<"  --steps   : number of cycles for --synthetic (default 10).\n";
+  std::cout<<"  --capture : the base path of a packed binary capture written by\n";
+  std::cout<<"              a relay extract with protocol 'capture/binary'. The\n";
+  std::cout<<"              capture is mmap'ed and every recorded cycle is\n";
+  std::cout<<"              published zero copy, so replay time is filter time.\n";
+  std::cout<<"              Must be run with the same number of ranks that\n";
+  std::cout<<"              wrote the capture.\n";
   std::cout<<"  --actions : a json file containing ascent actions. Default value\n";
   std::cout<<"              is 'ascent_actions.json'.\n\n";
   std::cout<<"======================== Examples =========================\n";
@@ -82,6 +105,10 @@ struct Options
   std::string m_actions_file = "ascent_actions.json";
   std::string m_root_file;
   std::string m_cycles_file;
+  std::string m_capture_file;
+  std::string m_synthetic;
+  int m_synthetic_size = 32;
+  int m_synthetic_steps = 10;
 
   void parse(int argc, char** argv)
   {
@@ -95,6 +122,22 @@ struct Options
       {
         m_cycles_file = get_arg(argv[i]);
       }
+      else if(contains(argv[i], "--capture="))
+      {
+        m_capture_file = get_arg(argv[i]);
+      }
+      else if(contains(argv[i], "--synthetic="))
+      {
+        m_synthetic = get_arg(argv[i]);
+      }
+      else if(contains(argv[i], "--size="))
+      {
+        m_synthetic_size = atoi(get_arg(argv[i]).c_str());
+      }
+      else if(contains(argv[i], "--steps="))
+      {
+        m_synthetic_steps = atoi(get_arg(argv[i]).c_str());
+      }
       else if(contains(argv[i], "--actions="))
       {
         m_actions_file = get_arg(argv[i]);
@@ -104,9 +147,11 @@ struct Options
         bad_arg(argv[i]);
       }
     }
-    if(m_root_file == "" && m_cycles_file == "")
+    if(m_root_file == "" && m_cycles_file == "" && m_capture_file == "" &&
+       m_synthetic == "")
     {
-      std::cerr<<"You must specify a '--root' or '--cycles' files. Bailing...\n";
+      std::cerr<<"You must specify '--root', '--cycles', '--capture', "
+               <<"or '--synthetic'. Bailing...\n";
       usage();
       exit(1);
     }
@@ -171,6 +216,107 @@ bool contains(const std::string haystack, std::string needle)
   }
 };
 
+//-----------------------------------------------------------------------------
+// replays a packed binary capture: the compact schema loads once, the
+// data file is mmap'ed (read wholesale where mmap is unavailable),
+// and every cycle publishes a zero copy view of its block
+int replay_capture(const std::string &capture_path,
+                   ascent::Ascent &ascent,
+                   conduit::Node &actions,
+                   int rank)
+{
+  char rank_buff[64];
+  snprintf(rank_buff, sizeof(rank_buff), "_rank_%05d", rank);
+  const std::string base = capture_path + rank_buff;
+  const std::string bin_file = base + ".capture";
+  const std::string schema_file = base + ".capture_schema.json";
+
+  std::ifstream schema_in(schema_file.c_str());
+  if(!schema_in.is_open())
+  {
+    std::cerr<<"failed to open capture schema '"<<schema_file<<"'\n";
+    return -1;
+  }
+  std::stringstream schema_ss;
+  schema_ss << schema_in.rdbuf();
+  conduit::Schema schema(schema_ss.str());
+  const size_t block_size = (size_t)schema.total_bytes_compact();
+  if(block_size == 0)
+  {
+    std::cerr<<"capture schema '"<<schema_file<<"' holds no data\n";
+    return -1;
+  }
+
+  const char *data = nullptr;
+  size_t data_size = 0;
+  std::vector<char> fallback;
+#ifdef REPLAY_HAS_MMAP
+  int fd = open(bin_file.c_str(), O_RDONLY);
+  if(fd < 0)
+  {
+    std::cerr<<"failed to open capture '"<<bin_file<<"'\n";
+    return -1;
+  }
+  struct stat st;
+  fstat(fd, &st);
+  data_size = (size_t)st.st_size;
+  void *mapped = mmap(NULL, data_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  if(mapped == MAP_FAILED)
+  {
+    close(fd);
+    std::cerr<<"failed to mmap capture '"<<bin_file<<"'\n";
+    return -1;
+  }
+  data = (const char*)mapped;
+#else
+  std::ifstream bin_in(bin_file.c_str(), std::ios::in | std::ios::binary);
+  if(!bin_in.is_open())
+  {
+    std::cerr<<"failed to open capture '"<<bin_file<<"'\n";
+    return -1;
+  }
+  bin_in.seekg(0, std::ios::end);
+  data_size = (size_t)bin_in.tellg();
+  bin_in.seekg(0, std::ios::beg);
+  fallback.resize(data_size);
+  bin_in.read(&fallback[0], data_size);
+  data = &fallback[0];
+#endif
+
+  const size_t num_cycles = data_size / block_size;
+
+  for(size_t c = 0; c < num_cycles; ++c)
+  {
+    conduit::Node view;
+    view.set_external(schema, (void*)(data + c * block_size));
+
+    flow::Timer publish;
+    ascent.publish(view);
+    float publish_time = publish.elapsed();
+
+    flow::Timer execute;
+    ascent.execute(actions);
+    float execute_time = execute.elapsed();
+
+    if(rank == 0)
+    {
+      std::cout<<"Capture cycle "<<c<<"\n";
+      std::cout<<" Publish --: "<<publish_time<<"\n";
+      std::cout<<" Execute --: "<<execute_time<<"\n";
+    }
+  }
+
+  // the runtime may still hold zero copy views into the mapped
+  // region, so tear it down before the mapping goes away
+  ascent.close();
+
+#ifdef REPLAY_HAS_MMAP
+  munmap((void*)data, data_size);
+  close(fd);
+#endif
+  return 0;
+}
+
 int main (int argc, char *argv[])
 {
   Options options;
@@ -222,6 +368,62 @@ int main (int argc, char *argv[])
   ascent::Ascent ascent;
   ascent.open(ascent_opts);
 
+  if(options.m_synthetic != "")
+  {
+    // synthetic source mode: generate a parameterized blueprint
+    // example mesh per cycle, so scaling and regression runs need no
+    // data files at all. Domain counts come from the rank count;
+    // each rank generates its own domain.
+    conduit::Node mesh;
+    for(int step = 0; step < options.m_synthetic_steps; ++step)
+    {
+      flow::Timer gen;
+      mesh.reset();
+      conduit::blueprint::mesh::examples::braid(
+          options.m_synthetic,
+          options.m_synthetic_size,
+          options.m_synthetic_size,
+          options.m_synthetic_size,
+          mesh);
+      mesh["state/domain_id"] = rank;
+      mesh["state/cycle"] = step;
+      mesh["state/time"] = (double)step;
+      float gen_time = gen.elapsed();
+
+      flow::Timer publish;
+      ascent.publish(mesh);
+      float publish_time = publish.elapsed();
+
+      flow::Timer execute;
+      ascent.execute(actions);
+      float execute_time = execute.elapsed();
+
+      if(rank == 0)
+      {
+        std::cout<<"Synthetic cycle "<<step<<"\n";
+        std::cout<<" Generate -: "<<gen_time<<"\n";
+        std::cout<<" Publish --: "<<publish_time<<"\n";
+        std::cout<<" Execute --: "<<execute_time<<"\n";
+      }
+    }
+
+    ascent.close();
+#ifdef REPLAY_MPI
+    MPI_Finalize();
+#endif
+    return 0;
+  }
+
+  if(options.m_capture_file != "")
+  {
+    // replay_capture closes ascent before unmapping the capture
+    int res = replay_capture(options.m_capture_file, ascent, actions, rank);
+#ifdef REPLAY_MPI
+    MPI_Finalize();
+#endif
+    return res;
+  }
+
   for(int i = 0; i < time_steps.size(); ++i)
   {
     replay_opts["root_file"] = time_steps[i];